@@ -0,0 +1,170 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+// Headless batch runner: runs every job of one or more job files back to back in one process,
+// sharing thread pools and loaded inputs between jobs. See JobFile in BatchJob.h for the format.
+// With --serve it stays resident instead and answers jobs sent over a Unix domain socket until
+// interrupted; see ProjectionService.h for the protocol.
+//
+// Usage: ALM-Batch <job file>... [--log error|warn|info|debug]
+//        ALM-Batch --serve <socket> [--threads <n>] [--log error|warn|info|debug]
+//
+// Prints one line per job; the exit code is 1 if any job file or job failed.
+//
+// Headless on Linux, from this directory:
+//     g++ -std=c++20 -O2 -DNDEBUG -I../ALM-MTT -I<eigen> Main.cpp -pthread -o alm-batch
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <exception>
+#include <csignal>
+#include "BatchJob.h"
+#include "ProjectionService.h"
+#include "CancellationToken.h"
+#include "Log.h"
+
+using namespace ALM;
+
+namespace {
+
+    Log::Level parseLevel(const std::string& text) {
+        if (text == "error") return Log::Level::Error;
+        if (text == "warn") return Log::Level::Warn;
+        if (text == "info") return Log::Level::Info;
+        if (text == "debug") return Log::Level::Debug;
+        throw std::invalid_argument("unknown log level " + text);
+    }
+
+    CancellationSource interrupted;
+
+    // Only stores to a lock-free atomic, so it is safe in a signal handler
+    extern "C" void onSignal(int) {
+        interrupted.cancel();
+    }
+
+    int serve(const std::string& socket_path, size_t threads) {
+        std::signal(SIGINT, onSignal);
+        std::signal(SIGTERM, onSignal);
+#ifdef SIGPIPE
+        std::signal(SIGPIPE, SIG_IGN);
+#endif
+
+        ProjectionService service(threads);
+        try {
+            service.serve(socket_path, interrupted.token());
+        }
+        catch (const std::exception& e) {
+            ALM_LOG_ERROR("{}", e.what());
+            Log::flush();
+            return 1;
+        }
+
+        LatencyStats stats = service.stats();
+        ALM_LOG_INFO("served {} requests ({} failed), p50 {}ms, p99 {}ms",
+            stats.requests, stats.errors, 1e3 * stats.p50, 1e3 * stats.p99);
+        Log::flush();
+        return 0;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::string> job_files;
+    std::string socket_path;
+    size_t threads = 0;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--log" && i + 1 < argc) {
+                Log::setLevel(parseLevel(argv[++i]));
+            }
+            else if (arg == "--serve" && i + 1 < argc) {
+                socket_path = argv[++i];
+            }
+            else if (arg == "--threads" && i + 1 < argc) {
+                threads = std::stoul(argv[++i]);
+            }
+            else {
+                job_files.push_back(arg);
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+
+    if (!socket_path.empty()) {
+        return serve(socket_path, threads);
+    }
+
+    if (job_files.empty()) {
+        std::cerr << "Usage: ALM-Batch <job file>... [--log error|warn|info|debug]\n"
+            << "       ALM-Batch --serve <socket> [--threads <n>] [--log error|warn|info|debug]\n";
+        return 1;
+    }
+
+    BatchRunner runner;
+    bool failed = false;
+
+    std::cout << std::left << std::setw(32) << "Job"
+        << std::right << std::setw(20) << "Value"
+        << std::setw(12) << "Scenarios"
+        << std::setw(12) << "Seconds" << "\n";
+
+    for (const auto& path : job_files) {
+        std::vector<BatchJob> jobs;
+        try {
+            jobs = JobFile::read(path);
+        }
+        catch (const std::exception& e) {
+            ALM_LOG_ERROR("{}", e.what());
+            failed = true;
+            continue;
+        }
+
+        for (const auto& job : jobs) {
+            try {
+                BatchOutcome outcome = runner.run(job);
+                if (!outcome.success) {
+                    ALM_LOG_WARN("job {}: solver did not converge in {} iterations", job.name, outcome.iterations);
+                }
+                Log::flush();
+                std::cout << std::left << std::setw(32) << outcome.name
+                    << std::right << std::setw(20) << std::fixed << std::setprecision(2) << outcome.value
+                    << std::setw(12) << (std::to_string(outcome.completed) + "/" + std::to_string(outcome.scenarios))
+                    << std::setw(12) << std::setprecision(3) << outcome.seconds << "\n";
+            }
+            catch (const std::exception& e) {
+                ALM_LOG_ERROR("job {}: {}", job.name, e.what());
+                failed = true;
+            }
+        }
+    }
+
+    Log::flush();
+    return failed ? 1 : 0;
+}
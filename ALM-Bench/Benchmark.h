@@ -0,0 +1,194 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <chrono>
+#include <algorithm>
+#include <ostream>
+#include <iomanip>
+#include <ctime>
+#include <thread>
+
+namespace ALM::Bench {
+
+    /**
+     * @brief Timing of a single benchmark.
+     */
+    struct Result {
+        std::string name;     ///< Registered benchmark name, with "/<size>" for sized benchmarks
+        size_t size;          ///< Problem size of a sized benchmark, 0 otherwise
+        size_t iterations;    ///< Operations timed
+        double seconds;       ///< Wall-clock time for all iterations
+
+        double nsPerOp() const {
+            return 1e9 * seconds / static_cast<double>(iterations);
+        }
+    };
+
+    /// A benchmark body; performs the measured operation `iterations` times.
+    using Function = std::function<void(size_t iterations)>;
+
+    /// A sized benchmark body; performs the measured operation `iterations` times at problem size `size`.
+    using SizedFunction = std::function<void(size_t iterations, size_t size)>;
+
+    /**
+     * @brief Global list of benchmarks, populated by Registrar objects at static initialization.
+     */
+    class Registry {
+    public:
+        static Registry& instance() {
+            static Registry registry;
+            return registry;
+        }
+
+        void add(std::string name, Function fn) {
+            benchmarks_.push_back({ std::move(name), 0, std::move(fn) });
+        }
+
+        /// Registers one benchmark per size, named "<name>/<size>"
+        void add(const std::string& name, const std::vector<size_t>& sizes, SizedFunction fn) {
+            for (size_t size : sizes) {
+                benchmarks_.push_back({ name + "/" + std::to_string(size), size, [fn, size](size_t iterations) {
+                    fn(iterations, size);
+                    } });
+            }
+        }
+
+        /**
+         * @brief Run every benchmark whose name contains the filter.
+         *
+         * Each benchmark is repeated with a growing iteration count until one run takes at
+         * least `min_seconds`, so fixed setup costs inside the body are amortized.
+         */
+        std::vector<Result> run(const std::string& filter = "", double min_seconds = 0.2) const {
+            std::vector<Result> results;
+
+            for (const auto& [name, size, fn] : benchmarks_) {
+                if (name.find(filter) == std::string::npos) continue;
+
+                size_t iterations = 1;
+                double seconds = 0.0;
+                while (true) {
+                    auto t0 = std::chrono::steady_clock::now();
+                    fn(iterations);
+                    auto t1 = std::chrono::steady_clock::now();
+                    seconds = std::chrono::duration<double>(t1 - t0).count();
+
+                    if (seconds >= min_seconds) break;
+
+                    double growth = seconds > 0.0 ? 1.5 * min_seconds / seconds : 10.0;
+                    iterations = static_cast<size_t>(iterations * std::clamp(growth, 2.0, 10.0));
+                }
+
+                results.push_back({ name, size, iterations, seconds });
+            }
+
+            return results;
+        }
+
+    private:
+        struct Entry {
+            std::string name;
+            size_t size;
+            Function fn;
+        };
+
+        std::vector<Entry> benchmarks_;
+    };
+
+    /**
+     * @brief Registers a benchmark when constructed, e.g. as a file-scope static.
+     */
+    struct Registrar {
+        Registrar(std::string name, Function fn) {
+            Registry::instance().add(std::move(name), std::move(fn));
+        }
+
+        Registrar(const std::string& name, const std::vector<size_t>& sizes, SizedFunction fn) {
+            Registry::instance().add(name, sizes, std::move(fn));
+        }
+    };
+
+    /**
+     * @brief Writes results as JSON for tracking across builds.
+     *
+     * The layout follows Google Benchmark's JSON output (a "context" object and a "benchmarks"
+     * array with real_time in time_unit per iteration), so its comparison tooling can diff runs.
+     */
+    inline void writeJson(std::ostream& out, const std::vector<Result>& results) {
+        auto quoted = [](const std::string& text) {
+            std::string escaped = "\"";
+            for (char c : text) {
+                if (c == '"' || c == '\\') escaped += '\\';
+                escaped += c;
+            }
+            return escaped + "\"";
+            };
+
+        std::time_t now = std::time(nullptr);
+        char date[32];
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+#ifdef NDEBUG
+        const char* build_type = "release";
+#else
+        const char* build_type = "debug";
+#endif
+
+        out << "{\n  \"context\": {\n"
+            << "    \"date\": " << quoted(date) << ",\n"
+            << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+            << "    \"library_build_type\": " << quoted(build_type) << "\n"
+            << "  },\n  \"benchmarks\": [";
+
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& result = results[i];
+            out << (i ? ",\n" : "\n")
+                << "    {\n"
+                << "      \"name\": " << quoted(result.name) << ",\n"
+                << "      \"run_type\": \"iteration\",\n"
+                << "      \"size\": " << result.size << ",\n"
+                << "      \"iterations\": " << result.iterations << ",\n"
+                << "      \"real_time\": " << std::setprecision(6) << std::fixed << result.nsPerOp() << ",\n"
+                << "      \"time_unit\": \"ns\"\n"
+                << "    }";
+        }
+        out << (results.empty() ? "]\n}\n" : "\n  ]\n}\n");
+    }
+
+    /// Keep a computed value alive so the optimizer cannot drop the work producing it.
+    inline void doNotOptimize(double value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+        static volatile double sink;  // MSVC has no inline asm on x64; a volatile store is kept
+        sink = value;
+#else
+        asm volatile("" : : "g"(value) : "memory");
+#endif
+    }
+
+}
@@ -0,0 +1,227 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+// Core kernels at parameterized sizes: date arithmetic, day counting, calendars, schedules,
+// cash flow generation, asset and portfolio valuation, repricing a cached valuation after a
+// curve relink, and the Brent solver.
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "Benchmark.h"
+#include "Date.h"
+#include "DayCounter.h"
+#include "Calendar.h"
+#include "Schedule.h"
+#include "CashFlowBuilder.h"
+#include "Asset.h"
+#include "Portfolio.h"
+#include "RelinkableHandle.h"
+#include "PortfolioValuation.h"
+#include "FlatForward.h"
+#include "BrentSolver.h"
+
+using namespace ALM;
+
+namespace {
+
+    const Date today({ 2025, 12, 31 });
+    const std::vector<size_t> tenors = { 5, 10, 30 };    // Years
+
+    // A year of consecutive start dates, so results cannot be folded to constants
+    std::vector<Date> days() {
+        std::vector<Date> dates;
+        for (int i = 0; i < 365; ++i) {
+            dates.push_back(Date(today.serial() + i));
+        }
+        return dates;
+    }
+
+    Asset bond(size_t years) {
+        return Asset(CashFlowBuilder::fixedRateBond(
+            today, today + Duration(static_cast<int>(years), Duration::Unit::Years), 0.04, 1000.0));
+    }
+
+    // Up to 10Y bonds with staggered maturities
+    Portfolio portfolio(size_t size) {
+        Portfolio held;
+        for (size_t k = 0; k < size; ++k) {
+            Date maturity = today + Duration(static_cast<int>(12 + k % 108), Duration::Unit::Months);
+            held.addAsset(Asset(CashFlowBuilder::fixedRateBond(today, maturity, 0.03 + 0.0001 * k, 1000.0)));
+        }
+        return held;
+    }
+
+    void yearFraction(DayCounter::Convention convention, size_t n, size_t years) {
+        DayCounter dc(convention);
+        std::vector<Date> starts = days();
+        Duration span(static_cast<int>(years), Duration::Unit::Years);
+        std::vector<Date> ends;
+        for (const Date& start : starts) ends.push_back(start + span);
+
+        for (size_t i = 0; i < n; ++i) {
+            size_t k = i % starts.size();
+            Bench::doNotOptimize(dc.yearFraction(starts[k], ends[k]));
+        }
+    }
+
+    // Sizes: dates converted per operation
+    Bench::Registrar serial_to_ymd("Core/Date/serialToYMD", { 1, 64, 4096 }, [](size_t n, size_t size) {
+        for (size_t i = 0; i < n; ++i) {
+            int total = 0;
+            for (size_t k = 0; k < size; ++k) {
+                total += Date::serialToYMD(today.serial() + static_cast<int>(k * 37 + i)).day;
+            }
+            Bench::doNotOptimize(total);
+        }
+        });
+
+    // Sizes: years between the two dates
+    Bench::Registrar actual_actual("Core/DayCounter/yearFraction<ActualActual>", { 1, 10, 30 }, [](size_t n, size_t size) {
+        yearFraction(DayCounter::Convention::ActualActual, n, size);
+        });
+
+    Bench::Registrar actual_365("Core/DayCounter/yearFraction<Actual365>", { 1, 10, 30 }, [](size_t n, size_t size) {
+        yearFraction(DayCounter::Convention::Actual365, n, size);
+        });
+
+    Bench::Registrar thirty_360("Core/DayCounter/yearFraction<Thirty360>", { 1, 10, 30 }, [](size_t n, size_t size) {
+        yearFraction(DayCounter::Convention::Thirty360, n, size);
+        });
+
+    // Sizes: holidays on the calendar
+    Bench::Registrar adjust("Core/Calendar/adjust<ModifiedFollowing>", { 0, 100, 1000 }, [](size_t n, size_t size) {
+        std::vector<Date> holidays;
+        for (size_t k = 0; k < size; ++k) {
+            holidays.push_back(Date(today.serial() + static_cast<int>(k * 11)));
+        }
+        Calendar calendar(holidays, Calendar::Convention::ModifiedFollowing);
+        std::vector<Date> dates = days();
+
+        for (size_t i = 0; i < n; ++i) {
+            Bench::doNotOptimize(calendar.adjust(dates[i % dates.size()]).serial());
+        }
+        });
+
+    // Sizes: tenor in years of a semiannual schedule
+    Bench::Registrar schedule("Core/Schedule/generate<6M>", tenors, [](size_t n, size_t size) {
+        Date end = today + Duration(static_cast<int>(size), Duration::Unit::Years);
+        for (size_t i = 0; i < n; ++i) {
+            Schedule dates(today, end, Duration(6, Duration::Unit::Months));
+            Bench::doNotOptimize(dates.dates().back().serial());
+        }
+        });
+
+    Bench::Registrar fixed_rate_bond("Core/CashFlowBuilder/fixedRateBond", tenors, [](size_t n, size_t size) {
+        Date maturity = today + Duration(static_cast<int>(size), Duration::Unit::Years);
+        for (size_t i = 0; i < n; ++i) {
+            Bench::doNotOptimize(CashFlowBuilder::fixedRateBond(today, maturity, 0.04, 1000.0).back().amount);
+        }
+        });
+
+    Bench::Registrar asset_value("Core/Asset/marketValue<FlatForward>", tenors, [](size_t n, size_t size) {
+        Asset asset = bond(size);
+        FlatForward curve(today, 0.04, DayCounter(DayCounter::Convention::ActualActual));
+        std::vector<Date> dates = days();
+
+        for (size_t i = 0; i < n; ++i) {
+            Bench::doNotOptimize(asset.marketValue(curve, dates[i % dates.size()]));
+        }
+        });
+
+    // One month of flows per operation, over the life of the bond
+    Bench::Registrar asset_cash_flow("Core/Asset/cashFlow", tenors, [](size_t n, size_t size) {
+        Asset asset = bond(size);
+        std::vector<Date> months;
+        for (int m = 0; m <= static_cast<int>(size) * 12; ++m) {
+            months.push_back(today + Duration(m, Duration::Unit::Months));
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            size_t k = i % (months.size() - 1);
+            Bench::doNotOptimize(asset.cashFlow(months[k], months[k + 1]));
+        }
+        });
+
+    // Sizes: assets held
+    Bench::Registrar portfolio_static("Core/Portfolio/marketValue<FlatForward>", { 10, 100, 1000 }, [](size_t n, size_t size) {
+        Portfolio held = portfolio(size);
+        FlatForward curve(today, 0.04, DayCounter(DayCounter::Convention::ActualActual));
+
+        for (size_t i = 0; i < n; ++i) {
+            Bench::doNotOptimize(held.marketValue(curve, today));
+        }
+        });
+
+    Bench::Registrar portfolio_virtual("Core/Portfolio/marketValue<YieldCurve>", { 10, 100, 1000 }, [](size_t n, size_t size) {
+        Portfolio held = portfolio(size);
+        std::shared_ptr<const YieldCurve> curve = std::make_shared<FlatForward>(today, 0.04, DayCounter(DayCounter::Convention::ActualActual));
+
+        for (size_t i = 0; i < n; ++i) {
+            Bench::doNotOptimize(held.marketValue(curve, today));
+        }
+        });
+
+    // Curve relink followed by a reprice; the cash-flow profile is reused and only discount
+    // factors on its payment dates are recomputed. Compare with marketValue<YieldCurve>.
+    Bench::Registrar portfolio_relink("Core/PortfolioValuation/relink+marketValue", { 10, 100, 1000 }, [](size_t n, size_t size) {
+        DayCounter dc(DayCounter::Convention::ActualActual);
+        std::shared_ptr<const YieldCurve> curves[2] = {
+            std::make_shared<FlatForward>(today, 0.04, dc), std::make_shared<FlatForward>(today, 0.041, dc) };
+        auto held = std::make_shared<RelinkableHandle<Portfolio>>(std::make_shared<const Portfolio>(portfolio(size)));
+        auto curve = std::make_shared<RelinkableHandle<YieldCurve>>(curves[0]);
+        PortfolioValuation valuation(std::make_shared<CashFlowProfile>(held), curve);
+
+        for (size_t i = 0; i < n; ++i) {
+            curve->reset(curves[(i + 1) % 2]);
+            Bench::doNotOptimize(valuation.marketValue(today));
+        }
+        curve->reclaim();
+        });
+
+    // Yield of a bond from its price; sizes: tenor in years
+    Bench::Registrar brent("Core/BrentSolver/bondYield", tenors, [](size_t n, size_t size) {
+        Asset asset = bond(size);
+        DayCounter dc(DayCounter::Convention::ActualActual);
+        std::vector<double> times, amounts;
+        for (const auto& cf : asset.cashFlows()) {
+            times.push_back(dc.yearFraction(today, cf.date));
+            amounts.push_back(cf.amount);
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            double price = 950.0 + static_cast<double>(i % 100);
+            auto f = [&](double y) {
+                double value = 0.0;
+                for (size_t k = 0; k < times.size(); ++k) {
+                    value += amounts[k] * std::exp(-y * times[k]);
+                }
+                return value - price;
+                };
+            BrentSolver solver;
+            Bench::doNotOptimize(solver.solve(f, -0.5, 1.0));
+        }
+        });
+
+}
@@ -0,0 +1,196 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+// Discount lookups at projection-scale call counts: dense-grid InterpolatedCurve versus
+// a naive binary-search interpolator and FlatForward. Bootstrap throughput per core.
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include "Benchmark.h"
+#include "Date.h"
+#include "DayCounter.h"
+#include "YieldCurve.h"
+#include "FlatForward.h"
+#include "InterpolatedCurve.h"
+#include "ParCurveBootstrapper.h"
+#include "SingleThreadedExecutor.h"
+
+using namespace ALM;
+
+namespace {
+
+    const Date today({ 2025, 12, 31 });
+    const DayCounter dc(DayCounter::Convention::ActualActual);
+
+    // Reference implementation: search the pillars and interpolate log discount on every call
+    class NaiveCurve final : public YieldCurve {
+    public:
+        NaiveCurve(const std::vector<Date>& dates, const std::vector<double>& zeros) {
+            x_.push_back(0.0);
+            y_.push_back(0.0);
+            for (size_t i = 0; i < dates.size(); ++i) {
+                double yf = dc.yearFraction(today, dates[i]);
+                x_.push_back(yf);
+                y_.push_back(-yf * std::log1p(zeros[i]));
+            }
+        }
+
+        double discount(const Date& t) const override {
+            double x = dc.yearFraction(today, t);
+            size_t n = x_.size();
+            if (x >= x_[n - 1]) {
+                double slope = (y_[n - 1] - y_[n - 2]) / (x_[n - 1] - x_[n - 2]);
+                return std::exp(y_[n - 1] + slope * (x - x_[n - 1]));
+            }
+            size_t k = static_cast<size_t>(std::upper_bound(x_.begin(), x_.end(), x) - x_.begin()) - 1;
+            double w = (x - x_[k]) / (x_[k + 1] - x_[k]);
+            return std::exp(y_[k] + w * (y_[k + 1] - y_[k]));
+        }
+        double zero(const Date&) const override { return 0.0; }
+        double forward(const Date&, const Date&) const override { return 0.0; }
+        Date reference() const override { return today; }
+
+    private:
+        std::vector<double> x_;
+        std::vector<double> y_;
+    };
+
+    std::vector<Date> pillars() {
+        std::vector<Date> dates;
+        for (int m : { 1, 3, 6, 12, 24, 36, 60, 84, 120, 180, 240, 360 }) {
+            dates.push_back(today + Duration(m, Duration::Unit::Months));
+        }
+        return dates;
+    }
+
+    std::vector<double> zeros() {
+        return { 0.030, 0.031, 0.032, 0.034, 0.036, 0.037, 0.039, 0.040, 0.042, 0.043, 0.044, 0.043 };
+    }
+
+    // Cash flow dates over 30 years, in the order a pricing loop would see them
+    const std::vector<Date>& lookupDates() {
+        static const std::vector<Date> dates = [] {
+            std::mt19937 rng(42);
+            std::uniform_int_distribution<int> day(0, 30 * 365);
+            std::vector<Date> d(100000);
+            for (auto& t : d) t = today + Duration(day(rng), Duration::Unit::Days);
+            return d;
+        }();
+        return dates;
+    }
+
+    // Iterations count discount() calls; virtual dispatch as in Projection
+    void lookups(const YieldCurve& curve, size_t n) {
+        const auto& dates = lookupDates();
+        double total = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            total += curve.discount(dates[i % dates.size()]);
+        }
+        Bench::doNotOptimize(total);
+    }
+
+    Bench::Registrar flat("Curve/discount/FlatForward", [](size_t n) {
+        lookups(FlatForward(today, 0.04, dc), n);
+        });
+
+    Bench::Registrar naive("Curve/discount/NaiveBinarySearch", [](size_t n) {
+        lookups(NaiveCurve(pillars(), zeros()), n);
+        });
+
+    Bench::Registrar daily("Curve/discount/InterpolatedCurve<LogLinear,daily>", [](size_t n) {
+        lookups(InterpolatedCurve::fromZeroRates(today, pillars(), zeros(), dc,
+            InterpolatedCurve::Interpolation::LogLinear, 1), n);
+        });
+
+    Bench::Registrar monthly("Curve/discount/InterpolatedCurve<LogLinear,30d>", [](size_t n) {
+        lookups(InterpolatedCurve::fromZeroRates(today, pillars(), zeros(), dc,
+            InterpolatedCurve::Interpolation::LogLinear, 30), n);
+        });
+
+    Bench::Registrar cubic("Curve/discount/InterpolatedCurve<MonotoneCubic,daily>", [](size_t n) {
+        lookups(InterpolatedCurve::fromZeroRates(today, pillars(), zeros(), dc,
+            InterpolatedCurve::Interpolation::MonotoneCubic, 1), n);
+        });
+
+    Bench::Registrar construction("Curve/construct/InterpolatedCurve<MonotoneCubic,daily>", [](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            auto curve = InterpolatedCurve::fromZeroRates(today, pillars(), zeros(), dc,
+                InterpolatedCurve::Interpolation::MonotoneCubic, 1);
+            Bench::doNotOptimize(curve.discount(today));
+        }
+        });
+
+    std::vector<Duration> tenors() {
+        std::vector<Duration> t;
+        for (int m : { 1, 3, 6, 12, 24, 36, 60, 84, 120, 180, 240, 360 }) {
+            t.push_back(Duration(m, Duration::Unit::Months));
+        }
+        return t;
+    }
+
+    // Par rates with a parallel shift and noise per scenario
+    std::vector<std::vector<double>> parScenarios(size_t n) {
+        std::mt19937 rng(7);
+        std::normal_distribution<double> shock(0.0, 0.005);
+        std::vector<std::vector<double>> scenarios(n, zeros());
+        for (auto& rates : scenarios) {
+            double shift = shock(rng);
+            for (auto& r : rates) r += shift + 0.2 * shock(rng);
+        }
+        return scenarios;
+    }
+
+    // Iterations count curves
+    Bench::Registrar pillars_only("Curve/bootstrap/discountFactors", [](size_t n) {
+        ParCurveBootstrapper bootstrapper(today, tenors());
+        auto scenarios = parScenarios(256);
+        double total = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            total += bootstrapper.discountFactors(scenarios[i % scenarios.size()]).back();
+        }
+        Bench::doNotOptimize(total);
+        });
+
+    void bootstrapCurves(int grid_days, size_t n) {
+        ParCurveBootstrapper bootstrapper(today, tenors(), Duration(6, Duration::Unit::Months), dc, Calendar(), grid_days);
+        auto scenarios = parScenarios(256);
+        SingleThreadedExecutor executor;
+        for (size_t done = 0; done < n; done += scenarios.size()) {
+            scenarios.resize(std::min(scenarios.size(), n - done));
+            auto curves = bootstrapper.bootstrap(scenarios, executor);
+            Bench::doNotOptimize(curves.back()->discount(today));
+        }
+    }
+
+    Bench::Registrar bootstrap_daily("Curve/bootstrap/InterpolatedCurve<daily>", [](size_t n) {
+        bootstrapCurves(1, n);
+        });
+
+    Bench::Registrar bootstrap_monthly("Curve/bootstrap/InterpolatedCurve<30d>", [](size_t n) {
+        bootstrapCurves(30, n);
+        });
+
+}
@@ -0,0 +1,121 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+// RelinkableHandle reads under contention: 1-64 reader threads each perform the iteration count
+// of reads, so ns/op is the per-read cost seen by one thread and stays flat while reads scale.
+// The shared_mutex variant is the previous handle implementation, kept here for comparison.
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include "Benchmark.h"
+#include "Date.h"
+#include "DayCounter.h"
+#include "FlatForward.h"
+#include "RelinkableHandle.h"
+
+using namespace ALM;
+
+namespace {
+
+    const Date today({ 2025, 12, 31 });
+    const std::vector<size_t> readers = { 1, 2, 4, 8, 16, 32, 64 };
+
+    template <typename T>
+    class SharedMutexHandle {
+    public:
+        explicit SharedMutexHandle(std::shared_ptr<const T> ptr)
+            : ptr_(std::move(ptr)) {
+        }
+
+        const T* operator->() const {
+            std::shared_lock lock(mutex_);
+            return ptr_.get();
+        }
+
+        void reset(std::shared_ptr<const T> new_ptr) {
+            std::unique_lock lock(mutex_);
+            ptr_ = std::move(new_ptr);
+        }
+
+    private:
+        std::shared_ptr<const T> ptr_;
+        mutable std::shared_mutex mutex_;
+    };
+
+    std::shared_ptr<const FlatForward> curve(double rate) {
+        return std::make_shared<FlatForward>(today, rate, DayCounter(DayCounter::Convention::ActualActual));
+    }
+
+    // Each of `threads` readers does n reads; with `relinks`, the caller relinks every 50us while they run
+    template <typename Handle>
+    void contend(Handle& handle, size_t n, size_t threads, bool relinks) {
+        std::atomic<size_t> running(threads);
+        std::vector<std::thread> pool;
+        pool.reserve(threads);
+        for (size_t t = 0; t < threads; ++t) {
+            pool.emplace_back([&handle, &running, n]() {
+                double sum = 0.0;
+                for (size_t i = 0; i < n; ++i) {
+                    sum += handle->reference().serial();
+                }
+                Bench::doNotOptimize(sum);
+                --running;
+                });
+        }
+
+        for (int relink = 0; relinks && running.load() > 0; ++relink) {
+            handle.reset(curve(0.03 + 0.0001 * (relink % 100)));
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+
+        for (auto& thread : pool) thread.join();
+    }
+
+    Bench::Registrar shared_mutex_reads("Handle/read/shared_mutex", readers, [](size_t n, size_t threads) {
+        SharedMutexHandle<FlatForward> handle(curve(0.04));
+        contend(handle, n, threads, false);
+        });
+
+    Bench::Registrar lock_free_reads("Handle/read/RelinkableHandle", readers, [](size_t n, size_t threads) {
+        RelinkableHandle<FlatForward> handle(curve(0.04));
+        contend(handle, n, threads, false);
+        });
+
+    Bench::Registrar shared_mutex_relinks("Handle/read+relink/shared_mutex", readers, [](size_t n, size_t threads) {
+        SharedMutexHandle<FlatForward> handle(curve(0.04));
+        contend(handle, n, threads, true);
+        });
+
+    Bench::Registrar lock_free_relinks("Handle/read+relink/RelinkableHandle", readers, [](size_t n, size_t threads) {
+        RelinkableHandle<FlatForward> handle(curve(0.04));
+        contend(handle, n, threads, true);
+        handle.reclaim();
+        });
+
+}
@@ -0,0 +1,85 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Benchmark.h"
+#include "Scaling.h"
+
+using namespace ALM;
+
+// Usage: ALM-Bench [filter] [--json <file>|-] [--min-time <seconds>]
+//        ALM-Bench --scaling [options], see ScalingBench.cpp
+int main(int argc, char** argv) {
+    if (argc > 1 && std::string(argv[1]) == "--scaling") {
+        return Bench::runScaling(std::vector<std::string>(argv + 2, argv + argc));
+    }
+
+    std::string filter;
+    std::string json_path;
+    double min_seconds = 0.2;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) {
+            json_path = argv[++i];
+        }
+        else if (arg == "--min-time" && i + 1 < argc) {
+            min_seconds = std::stod(argv[++i]);
+        }
+        else {
+            filter = arg;
+        }
+    }
+
+    auto results = Bench::Registry::instance().run(filter, min_seconds);
+
+    if (json_path == "-") {
+        Bench::writeJson(std::cout, results);
+        return 0;
+    }
+    if (!json_path.empty()) {
+        std::ofstream json(json_path);
+        if (!json) {
+            std::cerr << "Cannot write " << json_path << "\n";
+            return 1;
+        }
+        Bench::writeJson(json, results);
+    }
+
+    std::cout << std::left << std::setw(56) << "Benchmark"
+        << std::right << std::setw(14) << "Iterations"
+        << std::setw(16) << "ns/op" << "\n";
+
+    for (const auto& result : results) {
+        std::cout << std::left << std::setw(56) << result.name
+            << std::right << std::setw(14) << result.iterations
+            << std::setw(16) << std::fixed << std::setprecision(1) << result.nsPerOp() << "\n";
+    }
+
+    return 0;
+}
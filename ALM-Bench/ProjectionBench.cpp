@@ -0,0 +1,144 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+// Runtime-polymorphic Projection versus ProjectionKernel specialized on FlatForward, and a
+// nested projection.
+
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include "Benchmark.h"
+#include "Date.h"
+#include "DayCounter.h"
+#include "FlatForward.h"
+#include "CashFlowBuilder.h"
+#include "Portfolio.h"
+#include "Projection.h"
+#include "ProjectionKernel.h"
+#include "Rebalance.h"
+#include "SellProRata.h"
+#include "BuyBonds.h"
+#include "NestedProjection.h"
+#include "ThreadPoolExecutor.h"
+
+using namespace ALM;
+
+namespace {
+
+    const Date today({ 2025, 12, 31 });
+    const Date horizon = today + Duration(30, Duration::Unit::Years);
+    const Duration monthly(1, Duration::Unit::Months);
+
+    using StaticRebalance = Rebalance<SellProRata, BuyBonds>;
+
+    StaticRebalance strategy() {
+        return StaticRebalance(SellProRata(), BuyBonds({
+            { 0.5, 0.045, Duration(5, Duration::Unit::Years) },
+            { 0.5, 0.050, Duration(10, Duration::Unit::Years) },
+            }));
+    }
+
+    Portfolio assets() {
+        Portfolio portfolio;
+        for (int i = 0; i < 10; ++i) {
+            Date maturity = today + Duration((i + 1) * 2, Duration::Unit::Years);
+            portfolio.addAsset(Asset(CashFlowBuilder::fixedRateBond(today, maturity, 0.03 + 0.001 * i, 1000.0)));
+        }
+        return portfolio;
+    }
+
+    Portfolio liabilities() {
+        Portfolio portfolio;
+        for (int i = 1; i <= 30; ++i) {
+            portfolio.addAsset(Asset({ { today + Duration(i, Duration::Unit::Years), 1000.0 } }));
+        }
+        return portfolio;
+    }
+
+    Bench::Registrar runtime_projection("Projection/run30Y/Projection", [](size_t n) {
+        Projection projection(assets(), liabilities(), std::make_shared<StaticRebalance>(strategy()),
+            std::make_shared<FlatForward>(today, 0.04, DayCounter(DayCounter::Convention::ActualActual)),
+            today, horizon, monthly);
+
+        for (size_t i = 0; i < n; ++i) {
+            Bench::doNotOptimize(projection.run(1.0).ending_surplus);
+        }
+        });
+
+    Bench::Registrar kernel_projection("Projection/run30Y/ProjectionKernel<FlatForward>", [](size_t n) {
+        Portfolio a = assets();
+        Portfolio l = liabilities();
+        FlatForward curve(today, 0.04, DayCounter(DayCounter::Convention::ActualActual));
+        ProjectionKernel<FlatForward, StaticRebalance> kernel(a, l, strategy(), curve, today, horizon, monthly);
+
+        for (size_t i = 0; i < n; ++i) {
+            Bench::doNotOptimize(kernel.run(1.0).ending_surplus);
+        }
+        });
+
+    // 40 outer paths with five distinct curves, yearly nodes, eight inner scenarios per node,
+    // stepped monthly from a month-end. Doubles as a check: month-end clamping moves the steps
+    // to the 28th, every node must be a date the outer paths step on, and the tenth node
+    // (2035-12-28) falls before the 2035-12-31 end.
+    Bench::Registrar nested("Projection/nested/monthEnd", [](size_t n) {
+        DayCounter dc(DayCounter::Convention::ActualActual);
+        std::vector<std::shared_ptr<YieldCurve>> outer;
+        for (int p = 0; p < 40; ++p) {
+            outer.push_back(std::make_shared<FlatForward>(today, 0.03 + 0.0025 * (p % 5), dc));
+        }
+        auto inner = [dc](const Date& date, const std::shared_ptr<YieldCurve>&) {
+            std::vector<std::shared_ptr<YieldCurve>> curves;
+            for (int i = 0; i < 8; ++i) {
+                curves.push_back(std::make_shared<FlatForward>(date, 0.02 + 0.005 * i, dc));
+            }
+            return curves;
+            };
+        const size_t nodes = 10;
+
+        for (size_t i = 0; i < n; ++i) {
+            NestedProjection projection(assets(), liabilities(), std::make_shared<StaticRebalance>(strategy()),
+                std::make_shared<ThreadPoolExecutor>(4), outer, inner,
+                today, today + Duration(10, Duration::Unit::Years), monthly, Duration(1, Duration::Unit::Years));
+            NestedResult result = projection.run();
+
+            if (result.nodes.size() != nodes || result.nodes.front() != Date({ 2026, 12, 28 })
+                || result.inner_sets + result.cache_hits != outer.size() * nodes)
+                throw std::logic_error("Projection/nested/monthEnd: expected ten nodes from 2026-12-28");
+            for (const ProjectionResult& path : result.outer) {
+                for (size_t k = 0; k < nodes; ++k) {
+                    if (path.dates[12 * (k + 1)] != result.nodes[k])
+                        throw std::logic_error("Projection/nested/monthEnd: a node is not an outer step date");
+                }
+            }
+            for (const auto& values : result.values) {
+                for (double value : values) {
+                    if (!(value > 0.0))
+                        throw std::logic_error("Projection/nested/monthEnd: a node was not valued");
+                }
+            }
+            Bench::doNotOptimize(result.values.back().back());
+        }
+        });
+
+}
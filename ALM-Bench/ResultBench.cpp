@@ -0,0 +1,110 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+// Writing full projection histories: the text output of buffered results against streaming
+// them to a binary ResultFile from worker threads, and reading them back through the mapping.
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <functional>
+#include <filesystem>
+#include "Benchmark.h"
+#include "Date.h"
+#include "ProjectionKernel.h"
+#include "ResultFile.h"
+#include "ThreadPoolExecutor.h"
+
+using namespace ALM;
+
+namespace {
+
+    const Date today({ 2025, 12, 31 });
+
+    // A 30Y monthly history
+    const ProjectionResult& history() {
+        static const ProjectionResult result = []() {
+            ProjectionResult result;
+            result.scalar = 1.25;
+            for (int s = 0; s < 360; ++s) {
+                result.dates.push_back(today + Duration(s, Duration::Unit::Months));
+                result.assets_bop.push_back(1.0e6 - 2500.0 * s);
+                result.liabilities_bop.push_back(9.0e5 - 2400.0 * s);
+                result.cash_bop.push_back(10.0 * s);
+                result.surplus_bop.push_back(1.0e5 - 90.0 * s);
+            }
+            result.ending_surplus = result.surplus_bop.back();
+            return result;
+            }();
+        return result;
+    }
+
+    std::string scratch(const char* name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    // Iterations count 360-step results; all are held, then written as CSV
+    Bench::Registrar text("Results/write/text", [](size_t n) {
+        std::vector<ProjectionResult> results(n, history());
+        std::ofstream out(scratch("alm-bench-results.csv"), std::ios::trunc);
+        for (size_t i = 0; i < results.size(); ++i) {
+            const ProjectionResult& result = results[i];
+            for (size_t s = 0; s < result.dates.size(); ++s) {
+                out << i << ',' << result.dates[s].serial() << ',' << result.assets_bop[s] << ','
+                    << result.liabilities_bop[s] << ',' << result.cash_bop[s] << ',' << result.surplus_bop[s] << '\n';
+            }
+        }
+        });
+
+    // Sizes: appending threads
+    Bench::Registrar stream("Results/write/ResultWriter", { 1, 4 }, [](size_t n, size_t threads) {
+        ThreadPoolExecutor executor(threads);
+        ResultWriter writer(scratch("alm-bench-results.bin"));
+        std::vector<std::function<void()>> tasks;
+        for (size_t i = 0; i < n; ++i) {
+            tasks.push_back([&writer, i]() { writer.append(i, history()); });
+        }
+        executor.submitAndWait(tasks);
+        writer.close();
+        });
+
+    // Iterations count records scanned from a mapped file of 1000 results
+    Bench::Registrar read("Results/read/ResultFile", [](size_t n) {
+        static const std::string path = []() {
+            std::string path = scratch("alm-bench-results-read.bin");
+            ResultWriter writer(path);
+            for (size_t i = 0; i < 1000; ++i) writer.append(i, history());
+            writer.close();
+            return path;
+            }();
+        ResultFile file(path);
+        double total = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            for (double value : file.record(i % file.size()).surplus_bop) total += value;
+        }
+        Bench::doNotOptimize(total);
+        });
+
+}
@@ -0,0 +1,120 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Date.h"
+#include "DayCounter.h"
+#include "CashFlowBuilder.h"
+#include "Asset.h"
+#include "Portfolio.h"
+#include "FlatForward.h"
+#include "HullWhite.h"
+#include "ShortRateScenarioGenerator.h"
+#include "Philox.h"
+
+namespace ALM::Bench {
+
+    /**
+     * @brief Deterministic synthetic inforce for sizing runs.
+     *
+     * Draws come from Philox keyed on the seed and indexed by position, so a portfolio of n
+     * assets is the first n assets of any larger one and every size is reproducible.
+     */
+    struct SyntheticInforce {
+        /**
+         * @brief Semi-annual fixed-rate bonds with 1-30Y remaining term, issued up to a year
+         *        before `start`, 2-6% coupons and 500-1500 notional.
+         */
+        static Portfolio assets(size_t count, Date start, uint64_t seed = 1) {
+            Philox4x32 rng(seed);
+            Portfolio portfolio;
+            for (size_t i = 0; i < count; ++i) {
+                auto u = draw(rng, i);
+                Date issue = start - Duration(static_cast<int>(u[0] * 12.0), Duration::Unit::Months);
+                Date maturity = issue + Duration(1 + static_cast<int>(u[1] * 30.0), Duration::Unit::Years);
+                if (maturity <= start) maturity = start + Duration(1, Duration::Unit::Years);
+
+                portfolio.addAsset(Asset(CashFlowBuilder::fixedRateBond(
+                    issue, maturity, 0.02 + 0.04 * u[2], 500.0 + 1000.0 * u[3])));
+            }
+            return portfolio;
+        }
+
+        /**
+         * @brief Level annual annuities, one per ten assets, paying 200-500 for 5-40 years.
+         *
+         * Sized so the liabilities are of the same order as assets(10 * count), keeping the
+         * starting asset solve well inside its bracket.
+         */
+        static Portfolio liabilities(size_t count, Date start, uint64_t seed = 2) {
+            Philox4x32 rng(seed);
+            Portfolio portfolio;
+            for (size_t i = 0; i < count; ++i) {
+                auto u = draw(rng, i);
+                int term = 5 + static_cast<int>(u[0] * 36.0);
+                double payment = 200.0 + 300.0 * u[1];
+
+                std::vector<CashFlow> payments;
+                payments.reserve(term);
+                for (int year = 1; year <= term; ++year) {
+                    payments.push_back({ start + Duration(year, Duration::Unit::Years), payment });
+                }
+                portfolio.addAsset(Asset(std::move(payments)));
+            }
+            return portfolio;
+        }
+
+    private:
+        // Four uniforms on [0, 1) for item i
+        static std::array<double, 4> draw(const Philox4x32& rng, size_t i) {
+            auto bits = rng({ static_cast<uint32_t>(i), static_cast<uint32_t>(static_cast<uint64_t>(i) >> 32), 0, 0 });
+            return { bits[0] * 0x1.0p-32, bits[1] * 0x1.0p-32, bits[2] * 0x1.0p-32, bits[3] * 0x1.0p-32 };
+        }
+    };
+
+    /**
+     * @brief Hull-White scenarios around a flat 4% curve on a 30-day lookup grid, stepping with
+     *        the projection so each scenario curve has a pillar per projection date.
+     */
+    inline ShortRateScenarioGenerator syntheticScenarios(Date start, Date end, Duration step, uint64_t seed = 42) {
+        DayCounter dc(DayCounter::Convention::ActualActual);
+        return ShortRateScenarioGenerator(
+            std::make_shared<HullWhite>(0.1, 0.01, std::make_shared<FlatForward>(start, 0.04, dc)),
+            start, end, step, seed, dc, 30);
+    }
+
+    /**
+     * @brief End-to-end scaling sweep, see ScalingBench.cpp.
+     * @param args Command-line arguments following --scaling.
+     * @return Process exit code.
+     */
+    int runScaling(const std::vector<std::string>& args);
+
+}
@@ -0,0 +1,480 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+// End-to-end scaling of Projection and MultiScenarioProjection on synthetic inforce.
+//
+// Usage: ALM-Bench --scaling [--assets 1000,10000] [--scenarios 10,100] [--steps annual,monthly]
+//                  [--threads 1,2,4] [--years 30] [--weak-base <scenarios>] [--in-process]
+//                  [--json <file>|-]
+//
+// The full sizing grid is --assets 1000,10000,100000,1000000 --scenarios 10,100,1000,10000.
+// Throughput is in scenario-steps per second: scenarios times projection steps over wall-clock
+// time, where each multi-scenario run includes scenario generation and the starting asset solve.
+// On POSIX systems every configuration runs in a forked child so its peak RSS is its own; on
+// Windows, or with --in-process, peak RSS is the process high-water mark so far.
+//
+// Headless on Linux, from this directory:
+//     g++ -std=c++20 -O2 -DNDEBUG -I../ALM-MTT *.cpp -pthread -o alm-bench
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include "Scaling.h"
+#include "Projection.h"
+#include "MultiScenarioProjection.h"
+#include "ThreadPoolExecutor.h"
+#include "Rebalance.h"
+#include "SellProRata.h"
+#include "BuyBonds.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace ALM;
+
+namespace {
+
+    const Date today({ 2025, 12, 31 });
+
+    using StaticRebalance = Rebalance<SellProRata, BuyBonds>;
+
+    /**
+     * @brief One configuration of the sweep and its measurement.
+     */
+    struct Run {
+        std::string scaling;        ///< "single" (one Projection), "strong" or "weak"
+        std::string step;           ///< "annual" or "monthly"
+        size_t assets = 0;
+        size_t scenarios = 1;
+        size_t threads = 1;
+        size_t steps = 0;           ///< Projection steps per scenario
+        double seconds = 0.0;       ///< Wall-clock time of one run over all scenarios
+        double peak_rss = 0.0;      ///< Bytes
+        double speedup = 1.0;       ///< Against the first run of the same curve
+        double efficiency = 1.0;
+        bool ok = false;
+
+        double scenarioStepsPerSecond() const {
+            return seconds > 0.0 ? static_cast<double>(scenarios * steps) / seconds : 0.0;
+        }
+    };
+
+    struct Options {
+        std::vector<size_t> assets = { 1000, 10000 };
+        std::vector<size_t> scenarios = { 10, 100 };
+        std::vector<std::string> steps = { "annual", "monthly" };
+        std::vector<size_t> threads;
+        size_t weak_base = 0;
+        int years = 30;
+        bool isolated = true;
+        std::string json_path;
+    };
+
+    std::vector<size_t> parseSizes(const std::string& text) {
+        std::vector<size_t> sizes;
+        std::stringstream ss(text);
+        for (std::string item; std::getline(ss, item, ',');) {
+            size_t value = std::stoull(item);
+            if (value == 0) throw std::invalid_argument("sizes must be positive: " + text);
+            sizes.push_back(value);
+        }
+        if (sizes.empty()) throw std::invalid_argument("empty size list");
+        return sizes;
+    }
+
+    std::vector<std::string> parseNames(const std::string& text) {
+        std::vector<std::string> names;
+        std::stringstream ss(text);
+        for (std::string item; std::getline(ss, item, ',');) {
+            if (item != "annual" && item != "monthly")
+                throw std::invalid_argument("unknown step " + item + ", expected annual or monthly");
+            names.push_back(item);
+        }
+        return names;
+    }
+
+    // Powers of two up to the hardware concurrency, and the hardware concurrency itself
+    std::vector<size_t> defaultThreads() {
+        size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<size_t> threads;
+        for (size_t t = 1; t < hardware; t *= 2) threads.push_back(t);
+        threads.push_back(hardware);
+        return threads;
+    }
+
+    Duration stepDuration(const std::string& step) {
+        return step == "annual" ? Duration(1, Duration::Unit::Years) : Duration(1, Duration::Unit::Months);
+    }
+
+    std::shared_ptr<StaticRebalance> strategy() {
+        return std::make_shared<StaticRebalance>(SellProRata(), BuyBonds({
+            { 0.5, 0.045, Duration(5, Duration::Unit::Years) },
+            { 0.5, 0.050, Duration(10, Duration::Unit::Years) },
+            }));
+    }
+
+    double seconds(std::chrono::steady_clock::time_point since) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - since).count();
+    }
+
+    // Peak resident set of this process so far, in bytes
+    double peakRss() {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0.0;
+        return static_cast<double>(counters.PeakWorkingSetSize);
+#else
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+        return static_cast<double>(usage.ru_maxrss);
+#else
+        return 1024.0 * static_cast<double>(usage.ru_maxrss);
+#endif
+#endif
+    }
+
+    /**
+     * @brief Times one configuration in this process. Building the inforce is not timed;
+     *        a single projection is repeated for at least 0.2s and averaged.
+     */
+    void measure(Run& run, int years) {
+        Date end = today + Duration(years, Duration::Unit::Years);
+        Duration step = stepDuration(run.step);
+        Portfolio assets = Bench::SyntheticInforce::assets(run.assets, today);
+        Portfolio liabilities = Bench::SyntheticInforce::liabilities(std::max<size_t>(1, run.assets / 10), today);
+
+        if (run.scaling == "single") {
+            DayCounter dc(DayCounter::Convention::ActualActual);
+            Projection projection(std::move(assets), std::move(liabilities), strategy(),
+                std::make_shared<FlatForward>(today, 0.04, dc), today, end, step);
+
+            size_t repeats = 0;
+            auto t0 = std::chrono::steady_clock::now();
+            do {
+                run.steps = projection.run(1.0).dates.size();
+                ++repeats;
+            } while (seconds(t0) < 0.2);
+            run.seconds = seconds(t0) / static_cast<double>(repeats);
+        }
+        else {
+            auto generator = std::make_shared<ShortRateScenarioGenerator>(Bench::syntheticScenarios(today, end, step));
+            MultiScenarioProjection runner(std::move(assets), std::move(liabilities), strategy(),
+                std::make_shared<ThreadPoolExecutor>(run.threads), run.scenarios,
+                [generator](size_t i) -> std::shared_ptr<const YieldCurve> { return generator->scenario(i); },
+                today, end, step);
+
+            auto t0 = std::chrono::steady_clock::now();
+            auto results = runner.run();
+            run.seconds = seconds(t0);
+            run.steps = results.front().dates.size();
+        }
+
+        run.peak_rss = peakRss();
+        run.ok = true;
+    }
+
+    /**
+     * @brief Times one configuration in a forked child, taking peak RSS from the child alone.
+     * @return false if the child could not be started; the caller then measures in-process.
+     */
+    bool measureIsolated(Run& run, int years) {
+#ifdef _WIN32
+        return false;
+#else
+        int fds[2];
+        if (pipe(fds) != 0) return false;
+
+        std::cout.flush();
+        pid_t pid = fork();
+        if (pid < 0) {
+            close(fds[0]);
+            close(fds[1]);
+            return false;
+        }
+
+        if (pid == 0) {
+            close(fds[0]);
+            Run child = run;
+            try {
+                measure(child, years);
+            }
+            catch (const std::exception& e) {
+                std::cerr << "scaling run failed: " << e.what() << "\n";
+            }
+            double payload[3] = { child.ok ? 1.0 : 0.0, child.seconds, static_cast<double>(child.steps) };
+            ssize_t written = write(fds[1], payload, sizeof(payload));
+            _exit(written == static_cast<ssize_t>(sizeof(payload)) ? 0 : 1);
+        }
+
+        close(fds[1]);
+        double payload[3] = {};
+        size_t received = 0;
+        while (received < sizeof(payload)) {
+            ssize_t got = read(fds[0], reinterpret_cast<char*>(payload) + received, sizeof(payload) - received);
+            if (got <= 0) break;
+            received += static_cast<size_t>(got);
+        }
+        close(fds[0]);
+
+        int status = 0;
+        rusage usage{};
+        wait4(pid, &status, 0, &usage);
+
+        // A child killed for running out of memory reports nothing
+        run.ok = received == sizeof(payload) && payload[0] == 1.0;
+        run.seconds = payload[1];
+        run.steps = static_cast<size_t>(payload[2]);
+#ifdef __APPLE__
+        run.peak_rss = static_cast<double>(usage.ru_maxrss);
+#else
+        run.peak_rss = 1024.0 * static_cast<double>(usage.ru_maxrss);
+#endif
+        return true;
+#endif
+    }
+
+    void execute(Run& run, const Options& options) {
+        if (options.isolated && measureIsolated(run, options.years)) return;
+        try {
+            measure(run, options.years);
+        }
+        catch (const std::exception& e) {
+            std::cerr << "scaling run failed: " << e.what() << "\n";
+        }
+    }
+
+    void printHeader(const std::string& title, bool scenarios) {
+        std::cout << "\n" << title << "\n"
+            << std::left << std::setw(9) << "step"
+            << std::right << std::setw(10) << "assets";
+        if (scenarios) std::cout << std::setw(11) << "scenarios" << std::setw(9) << "threads";
+        std::cout << std::setw(8) << "steps"
+            << std::setw(13) << "seconds"
+            << std::setw(18) << "scen-steps/s";
+        if (scenarios) std::cout << std::setw(10) << "speedup" << std::setw(12) << "efficiency";
+        std::cout << std::setw(14) << "peak RSS MB" << "\n";
+    }
+
+    void printRow(const Run& run, bool scenarios) {
+        std::cout << std::left << std::setw(9) << run.step
+            << std::right << std::setw(10) << run.assets;
+        if (scenarios) std::cout << std::setw(11) << run.scenarios << std::setw(9) << run.threads;
+        if (!run.ok) {
+            std::cout << "   failed\n";
+            return;
+        }
+        std::cout << std::setw(8) << run.steps
+            << std::fixed << std::setprecision(4) << std::setw(13) << run.seconds
+            << std::setprecision(0) << std::setw(18) << run.scenarioStepsPerSecond();
+        if (scenarios) {
+            std::cout << std::setprecision(2) << std::setw(10) << run.speedup
+                << std::setw(12) << run.efficiency;
+        }
+        std::cout << std::setprecision(1) << std::setw(14) << run.peak_rss / (1024.0 * 1024.0) << "\n";
+    }
+
+    // Speedup and efficiency of a run against the first run of its curve
+    void relate(Run& run, const Run& base) {
+        if (!run.ok || !base.ok) return;
+        if (run.scaling == "strong") {
+            run.speedup = base.seconds / run.seconds;
+            run.efficiency = run.speedup * static_cast<double>(base.threads) / static_cast<double>(run.threads);
+        }
+        else {
+            // Work grows with the thread count, so perfect scaling keeps the time constant
+            run.speedup = (base.seconds / run.seconds) * static_cast<double>(run.threads) / static_cast<double>(base.threads);
+            run.efficiency = base.seconds / run.seconds;
+        }
+    }
+
+    void writeJson(std::ostream& out, const std::vector<Run>& runs, bool isolated) {
+        std::time_t now = std::time(nullptr);
+        char date[32];
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+        out << "{\n  \"context\": {\n"
+            << "    \"date\": \"" << date << "\",\n"
+            << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+            << "    \"isolated\": " << (isolated ? "true" : "false") << "\n"
+            << "  },\n  \"runs\": [";
+
+        for (size_t i = 0; i < runs.size(); ++i) {
+            const Run& run = runs[i];
+            out << (i ? ",\n" : "\n")
+                << "    {\n"
+                << "      \"scaling\": \"" << run.scaling << "\",\n"
+                << "      \"step\": \"" << run.step << "\",\n"
+                << "      \"assets\": " << run.assets << ",\n"
+                << "      \"scenarios\": " << run.scenarios << ",\n"
+                << "      \"threads\": " << run.threads << ",\n"
+                << "      \"ok\": " << (run.ok ? "true" : "false") << ",\n"
+                << "      \"steps\": " << run.steps << ",\n"
+                << std::setprecision(6) << std::fixed
+                << "      \"seconds\": " << run.seconds << ",\n"
+                << "      \"scenario_steps_per_second\": " << run.scenarioStepsPerSecond() << ",\n"
+                << "      \"speedup\": " << run.speedup << ",\n"
+                << "      \"efficiency\": " << run.efficiency << ",\n"
+                << std::setprecision(0)
+                << "      \"peak_rss_bytes\": " << run.peak_rss << "\n"
+                << "    }";
+        }
+        out << (runs.empty() ? "]\n}\n" : "\n  ]\n}\n");
+    }
+
+    void usage() {
+        std::cerr << "Usage: ALM-Bench --scaling [--assets n,...] [--scenarios n,...] [--steps annual,monthly]\n"
+            << "                 [--threads n,...] [--years n] [--weak-base n] [--in-process] [--json <file>|-]\n";
+    }
+
+}
+
+namespace ALM::Bench {
+
+    int runScaling(const std::vector<std::string>& args) {
+        Options options;
+        try {
+            for (size_t i = 0; i < args.size(); ++i) {
+                const std::string& arg = args[i];
+                bool has_value = i + 1 < args.size();
+                if (arg == "--in-process") options.isolated = false;
+                else if (arg == "--assets" && has_value) options.assets = parseSizes(args[++i]);
+                else if (arg == "--scenarios" && has_value) options.scenarios = parseSizes(args[++i]);
+                else if (arg == "--threads" && has_value) options.threads = parseSizes(args[++i]);
+                else if (arg == "--steps" && has_value) options.steps = parseNames(args[++i]);
+                else if (arg == "--weak-base" && has_value) options.weak_base = parseSizes(args[++i]).front();
+                else if (arg == "--years" && has_value) options.years = std::stoi(args[++i]);
+                else if (arg == "--json" && has_value) options.json_path = args[++i];
+                else {
+                    usage();
+                    return 1;
+                }
+            }
+        }
+        catch (const std::exception& e) {
+            std::cerr << e.what() << "\n";
+            usage();
+            return 1;
+        }
+
+        if (options.threads.empty()) options.threads = defaultThreads();
+        std::sort(options.threads.begin(), options.threads.end());
+        if (options.weak_base == 0) options.weak_base = *std::min_element(options.scenarios.begin(), options.scenarios.end());
+
+        // With JSON on stdout the tables go to stderr
+        std::streambuf* table = std::cout.rdbuf();
+        if (options.json_path == "-") std::cout.rdbuf(std::cerr.rdbuf());
+
+        std::vector<Run> runs;
+
+        printHeader("Projection: one scenario, one thread", false);
+        for (const auto& step : options.steps) {
+            for (size_t assets : options.assets) {
+                Run run;
+                run.scaling = "single";
+                run.step = step;
+                run.assets = assets;
+                execute(run, options);
+                printRow(run, false);
+                runs.push_back(run);
+            }
+        }
+
+        printHeader("MultiScenarioProjection: strong scaling (fixed scenarios)", true);
+        for (const auto& step : options.steps) {
+            for (size_t assets : options.assets) {
+                for (size_t scenarios : options.scenarios) {
+                    size_t base = runs.size();
+                    for (size_t threads : options.threads) {
+                        Run run;
+                        run.scaling = "strong";
+                        run.step = step;
+                        run.assets = assets;
+                        run.scenarios = scenarios;
+                        run.threads = threads;
+                        execute(run, options);
+                        relate(run, runs.size() > base ? runs[base] : run);
+                        printRow(run, true);
+                        runs.push_back(run);
+                    }
+                }
+            }
+        }
+
+        printHeader("MultiScenarioProjection: weak scaling (" + std::to_string(options.weak_base) + " scenarios per thread)", true);
+        for (const auto& step : options.steps) {
+            for (size_t assets : options.assets) {
+                size_t base = runs.size();
+                for (size_t threads : options.threads) {
+                    Run run;
+                    run.scaling = "weak";
+                    run.step = step;
+                    run.assets = assets;
+                    run.scenarios = options.weak_base * threads;
+                    run.threads = threads;
+                    execute(run, options);
+                    relate(run, runs.size() > base ? runs[base] : run);
+                    printRow(run, true);
+                    runs.push_back(run);
+                }
+            }
+        }
+
+        std::cout.rdbuf(table);
+
+        if (options.json_path == "-") {
+            writeJson(std::cout, runs, options.isolated);
+        }
+        else if (!options.json_path.empty()) {
+            std::ofstream json(options.json_path);
+            if (!json) {
+                std::cerr << "Cannot write " << options.json_path << "\n";
+                return 1;
+            }
+            writeJson(json, runs, options.isolated);
+        }
+
+        return 0;
+    }
+
+}
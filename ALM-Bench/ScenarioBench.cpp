@@ -0,0 +1,136 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+// Scenario generation throughput per core: 30Y monthly short-rate paths to pathwise curves,
+// the cost of quasi-random versus pseudo-random draws, and scenario reduction.
+
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "Benchmark.h"
+#include "Date.h"
+#include "DayCounter.h"
+#include "FlatForward.h"
+#include "SingleThreadedExecutor.h"
+#include "ShortRateScenarioGenerator.h"
+#include "HullWhite.h"
+#include "Vasicek.h"
+#include "CoxIngersollRoss.h"
+#include "ScenarioReducer.h"
+
+using namespace ALM;
+
+namespace {
+
+    const Date today({ 2025, 12, 31 });
+    const DayCounter dc(DayCounter::Convention::ActualActual);
+
+    // Iterations count scenarios
+    void generate(std::shared_ptr<const ShortRateModel> model, int grid_days, size_t n) {
+        ShortRateScenarioGenerator generator(model, today, today + Duration(30, Duration::Unit::Years),
+            Duration(1, Duration::Unit::Months), 42, dc, grid_days);
+        SingleThreadedExecutor executor;
+        for (size_t done = 0; done < n; done += 256) {
+            auto curves = generator.generate(done, std::min<size_t>(256, n - done), executor);
+            Bench::doNotOptimize(curves.back()->discount(today + Duration(10, Duration::Unit::Years)));
+        }
+    }
+
+    Bench::Registrar paths("Scenario/shortRates/HullWhite", [](size_t n) {
+        ShortRateScenarioGenerator generator(std::make_shared<HullWhite>(0.1, 0.01, std::make_shared<FlatForward>(today, 0.04, dc)),
+            today, today + Duration(30, Duration::Unit::Years));
+        for (size_t i = 0; i < n; ++i) {
+            Bench::doNotOptimize(generator.shortRates(i).back());
+        }
+        });
+
+    Bench::Registrar hull_white("Scenario/generate/HullWhite<daily>", [](size_t n) {
+        generate(std::make_shared<HullWhite>(0.1, 0.01, std::make_shared<FlatForward>(today, 0.04, dc)), 1, n);
+        });
+
+    Bench::Registrar hull_white_monthly("Scenario/generate/HullWhite<30d>", [](size_t n) {
+        generate(std::make_shared<HullWhite>(0.1, 0.01, std::make_shared<FlatForward>(today, 0.04, dc)), 30, n);
+        });
+
+    Bench::Registrar sobol("Scenario/draws/Sobol+BrownianBridge", [](size_t n) {
+        ScenarioSampling sampling;
+        sampling.method = ScenarioSampling::Method::Sobol;
+        sampling.brownian_bridge = true;
+        sampling.replicate_size = 1024;
+        ShortRateScenarioGenerator generator(std::make_shared<Vasicek>(0.1, 0.04, 0.01, 0.03),
+            today, today + Duration(30, Duration::Unit::Years), Duration(1, Duration::Unit::Months), 42, dc, 1, sampling);
+        for (size_t i = 0; i < n; ++i) {
+            Bench::doNotOptimize(generator.draws(i).back());
+        }
+        });
+
+    Bench::Registrar pseudo("Scenario/draws/Philox", [](size_t n) {
+        ShortRateScenarioGenerator generator(std::make_shared<Vasicek>(0.1, 0.04, 0.01, 0.03),
+            today, today + Duration(30, Duration::Unit::Years));
+        for (size_t i = 0; i < n; ++i) {
+            Bench::doNotOptimize(generator.draws(i).back());
+        }
+        });
+
+    Bench::Registrar vasicek("Scenario/generate/Vasicek<daily>", [](size_t n) {
+        generate(std::make_shared<Vasicek>(0.1, 0.04, 0.01, 0.03), 1, n);
+        });
+
+    Bench::Registrar cir("Scenario/generate/CoxIngersollRoss<daily>", [](size_t n) {
+        generate(std::make_shared<CoxIngersollRoss>(0.1, 0.04, 0.05, 0.03), 1, n);
+        });
+
+    // Iterations count reductions of 2000 scenarios to 100 representatives
+    Bench::Registrar reduce("Scenario/reduce/2000->100", [](size_t n) {
+        auto executor = std::make_shared<SingleThreadedExecutor>();
+        ShortRateScenarioGenerator generator(std::make_shared<HullWhite>(0.1, 0.01, std::make_shared<FlatForward>(today, 0.04, dc)),
+            today, today + Duration(30, Duration::Unit::Years), Duration(1, Duration::Unit::Months), 42, dc, 30);
+        auto curves = generator.generate(0, 2000, *executor);
+        ScenarioReducer reducer(ScenarioReducer::featureDates(today, Duration(30, Duration::Unit::Years)), executor);
+        for (size_t i = 0; i < n; ++i) {
+            Bench::doNotOptimize(reducer.reduce(curves, 100).mean_distance);
+        }
+        });
+
+    // Iterations count reductions of six curves, two distinct, asked for four representatives.
+    // Doubles as a check: the reduction must stop at one representative per distinct curve.
+    Bench::Registrar duplicates("Scenario/reduce/duplicates", [](size_t n) {
+        auto executor = std::make_shared<SingleThreadedExecutor>();
+        std::vector<std::shared_ptr<YieldCurve>> curves;
+        for (int i = 0; i < 6; ++i) {
+            curves.push_back(std::make_shared<FlatForward>(today, i % 2 ? 0.03 : 0.05, dc));
+        }
+        ScenarioReducer reducer(ScenarioReducer::featureDates(today, Duration(30, Duration::Unit::Years)), executor);
+        for (size_t i = 0; i < n; ++i) {
+            ReducedScenarios reduced = reducer.reduce(curves, 4);
+            if (reduced.medoids.size() != 2 || reduced.weights.size() != 2 || reduced.curves.size() != 2
+                || std::abs(reduced.weights[0] - 0.5) > 1e-12 || reduced.mean_distance != 0.0)
+                throw std::logic_error("Scenario/reduce/duplicates: expected two equally weighted representatives");
+            Bench::doNotOptimize(reduced.mean_distance);
+        }
+        });
+
+}
@@ -0,0 +1,122 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+// Static (Rebalance<SellProRata, BuyBonds>) versus virtual (RebalanceStrategy) strategy dispatch.
+
+#include <memory>
+#include <vector>
+#include "Benchmark.h"
+#include "Date.h"
+#include "DayCounter.h"
+#include "FlatForward.h"
+#include "CashFlowBuilder.h"
+#include "Portfolio.h"
+#include "Projection.h"
+#include "RebalanceStrategy.h"
+#include "Rebalance.h"
+#include "SellProRata.h"
+#include "BuyBonds.h"
+
+using namespace ALM;
+
+namespace {
+
+    const Date today({ 2025, 12, 31 });
+
+    std::vector<BuyBonds::BondTemplate> bondTemplates() {
+        return {
+            { 0.25, 0.040, Duration(2, Duration::Unit::Years) },
+            { 0.25, 0.045, Duration(5, Duration::Unit::Years) },
+            { 0.25, 0.050, Duration(10, Duration::Unit::Years) },
+            { 0.25, 0.055, Duration(30, Duration::Unit::Years) },
+        };
+    }
+
+    Portfolio assets() {
+        Portfolio portfolio;
+        for (int i = 0; i < 10; ++i) {
+            Date maturity = today + Duration((i + 1) * 2, Duration::Unit::Years);
+            portfolio.addAsset(Asset(CashFlowBuilder::fixedRateBond(today, maturity, 0.03 + 0.001 * i, 1000.0)));
+        }
+        return portfolio;
+    }
+
+    Portfolio liabilities() {
+        Portfolio portfolio;
+        for (int i = 1; i <= 30; ++i) {
+            portfolio.addAsset(Asset({ { today + Duration(i, Duration::Unit::Years), 1000.0 } }));
+        }
+        return portfolio;
+    }
+
+    std::shared_ptr<YieldCurve> curve() {
+        return std::make_shared<FlatForward>(today, 0.04, DayCounter(DayCounter::Convention::ActualActual));
+    }
+
+    // Alternate shortfalls and surpluses so both branches of the rebalance are exercised
+    template <typename StrategyT>
+    void applySteps(StrategyT& strategy, size_t iterations) {
+        Portfolio portfolio = assets();
+        std::shared_ptr<const YieldCurve> c = curve();
+        double mv = portfolio.marketValue(c, today);
+
+        for (size_t i = 0; i < iterations; ++i) {
+            double cash = (i % 2 == 0) ? -100.0 : 100.0;
+            StepContext step{ today, today + Duration(1, Duration::Unit::Months), mv, 0.0, 0.0, 0.0 };
+            strategy.apply(portfolio, cash, step, c);
+            mv = step.assets_mv;
+        }
+        Bench::doNotOptimize(mv);
+    }
+
+    void project(const std::shared_ptr<Strategy>& strategy, size_t iterations) {
+        Projection projection(assets(), liabilities(), strategy, curve(),
+            today, today + Duration(30, Duration::Unit::Years), Duration(1, Duration::Unit::Months));
+
+        for (size_t i = 0; i < iterations; ++i) {
+            Bench::doNotOptimize(projection.run(1.0).ending_surplus);
+        }
+    }
+
+    Bench::Registrar virtual_apply("Strategy/apply/RebalanceStrategy", [](size_t n) {
+        std::shared_ptr<Strategy> strategy = std::make_shared<RebalanceStrategy>(
+            std::make_shared<SellProRata>(), std::make_shared<BuyBonds>(bondTemplates()));
+        applySteps(*strategy, n);
+        });
+
+    Bench::Registrar static_apply("Strategy/apply/Rebalance<SellProRata,BuyBonds>", [](size_t n) {
+        Rebalance<SellProRata, BuyBonds> strategy{ SellProRata(), BuyBonds(bondTemplates()) };
+        applySteps(strategy, n);
+        });
+
+    Bench::Registrar virtual_projection("Strategy/Projection30Y/RebalanceStrategy", [](size_t n) {
+        project(std::make_shared<RebalanceStrategy>(
+            std::make_shared<SellProRata>(), std::make_shared<BuyBonds>(bondTemplates())), n);
+        });
+
+    Bench::Registrar static_projection("Strategy/Projection30Y/Rebalance<SellProRata,BuyBonds>", [](size_t n) {
+        project(std::make_shared<Rebalance<SellProRata, BuyBonds>>(SellProRata(), BuyBonds(bondTemplates())), n);
+        });
+
+}
@@ -1,8 +1,10 @@
 #pragma once
 
-#include <Eigen/dense>
+#include <Eigen/Dense>
+#ifdef _WIN32
 #define NOMINMAX // windows uses preprocessor min/maxes that blow up algorithm
 #include <windows.h>
+#endif
 
 #include <vector>
 #include <memory>
@@ -17,10 +19,19 @@
 #include <cmath>
 #include <iomanip>
 
+#include "Log.h"
 #include "UI.h"
 #include "TaskExecutor.h"
 #include "SingleThreadedExecutor.h"
 #include "MultiThreadedExecutor.h"
+#include "ThreadPoolExecutor.h"
+#include "BoundedQueue.h"
+#include "CancellationToken.h"
+#include "Trace.h"
+#include "Observable.h"
+#include "MappedFile.h"
+#include "Philox.h"
+#include "SobolSequence.h"
 
 #include "Date.h"
 #include "DayCounter.h"
@@ -29,23 +40,45 @@
 
 #include "YieldCurve.h"
 #include "FlatForward.h"
+#include "InterpolatedCurve.h"
+#include "ParCurveBootstrapper.h"
+#include "ScenarioSet.h"
+
+#include "ShortRateModel.h"
+#include "Vasicek.h"
+#include "CoxIngersollRoss.h"
+#include "HullWhite.h"
+#include "BrownianBridge.h"
+#include "ShortRateScenarioGenerator.h"
+#include "ScenarioReducer.h"
 
 #include "CashFlow.h"
 #include "Asset.h"
 #include "Portfolio.h"
+#include "PortfolioValuation.h"
+#include "InforceFile.h"
 
 #include "Strategy.h"
 #include "RebalanceStrategy.h"
+#include "Rebalance.h"
 #include "BuyBonds.h"
 #include "SellProRata.h"
 
+#include "ProjectionKernel.h"
 #include "Projection.h"
 #include "MultiScenarioProjection.h"
+#include "ShardedProjection.h"
+#include "ResultFile.h"
+#include "NestedProjection.h"
 #include "StartingAssetSolver.h"
+#include "MonteCarloEstimator.h"
 
 #include "Constraint.h"
 #include "BoxConstraint.h"
 #include "SolverXd.h"
 #include "BrentSolver.h"
 #include "ProjectedGradientSolver.h"
-#include "TrustRegionSolver.h"
\ No newline at end of file
+#include "TrustRegionSolver.h"
+
+#include "BatchJob.h"
+#include "ProjectionService.h"
\ No newline at end of file
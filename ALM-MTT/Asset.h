@@ -25,6 +25,7 @@
 #pragma once
 
 #include <vector>
+#include <algorithm>
 #include "Date.h"
 #include "DayCounter.h"
 #include "YieldCurve.h"
@@ -47,6 +48,9 @@ namespace ALM {
          */
         Asset(std::vector<CashFlow> cash_flows, double volume = 1.0)
             : cash_flows_(std::move(cash_flows)), volume_(volume) {
+            for (const auto& cf : cash_flows_) {
+                maturity_ = std::max(maturity_, cf.date);
+            }
         }
 
         /**
@@ -56,14 +60,24 @@ namespace ALM {
          * @return Present value of future cash flows after the reference date, scaled by volume.
          */
         double marketValue(const std::shared_ptr<const YieldCurve>& curve, const Date& ref) const {
+            return marketValue(*curve, ref);
+        }
+
+        /**
+         * @brief Market value against a curve of known type.
+         *
+         * When Curve is a concrete (final) curve, discount() is bound statically and can be inlined.
+         */
+        template <YieldCurveType Curve>
+        double marketValue(const Curve& curve, const Date& ref) const {
             double total = 0.0;
             for (const auto& cf : cash_flows_) {
                 if (cf.date >= ref) {
-                    double df = curve->discount(cf.date);
+                    double df = curve.discount(cf.date);
                     total += cf.amount * df;
                 }
             }
-            return total * volume_ / curve->discount(ref);
+            return total * volume_ / curve.discount(ref);
         }
 
         /**
@@ -92,9 +106,67 @@ namespace ALM {
             return volume_;
         }
 
+        /// Unscaled cash flows (multiply by volume for the held amounts)
+        const std::vector<CashFlow>& cashFlows() const {
+            return cash_flows_;
+        }
+
+        /// Date of the last cash flow; the asset has no value or flows after it
+        Date maturity() const {
+            return maturity_;
+        }
+
+        /**
+         * @brief Whether the asset has no cash flows on or after the reference date.
+         *
+         * Matches marketValue and cashFlow: a flow dated on `ref` is still valued at `ref`.
+         */
+        bool hasMatured(const Date& ref) const {
+            return maturity_ < ref;
+        }
+
+        /**
+         * @brief Fold another asset into this one, summing cash flow amounts that share a date.
+         *
+         * Value and cash flows are linear in the amounts, so the merged asset values and pays
+         * what the two did separately. The other asset's amounts are converted to this asset's
+         * volume units.
+         *
+         * @param other The asset to absorb.
+         * @param volume Volume at which the other asset is held.
+         */
+        void merge(const Asset& other, double volume) {
+            double ratio = volume;
+            if (volume_ != 0.0) {
+                ratio /= volume_;
+            }
+            else {
+                cash_flows_.clear();  // nothing held; take on the other asset's units
+                volume_ = 1.0;
+            }
+
+            cash_flows_.reserve(cash_flows_.size() + other.cash_flows_.size());
+            for (const auto& cf : other.cash_flows_) {
+                cash_flows_.push_back(CashFlow{ cf.date, cf.amount * ratio });
+            }
+            std::stable_sort(cash_flows_.begin(), cash_flows_.end(),
+                [](const CashFlow& a, const CashFlow& b) { return a.date < b.date; });
+
+            // Bucket by date
+            size_t last = 0;
+            for (size_t i = 1; i < cash_flows_.size(); ++i) {
+                if (cash_flows_[i].date == cash_flows_[last].date) cash_flows_[last].amount += cash_flows_[i].amount;
+                else cash_flows_[++last] = cash_flows_[i];
+            }
+            if (!cash_flows_.empty()) cash_flows_.resize(last + 1);
+
+            maturity_ = std::max(maturity_, other.maturity_);
+        }
+
     private:
-        std::vector<ALM::CashFlow> cash_flows_;  ///< Immutable list of original cash flows
+        std::vector<ALM::CashFlow> cash_flows_;  ///< Cash flows by date; only merge() changes them
         double volume_;                          ///< Scalar multiplier applied to cash flows
+        Date maturity_;                          ///< Latest cash flow date
     };
 
 }
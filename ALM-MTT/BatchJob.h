@@ -0,0 +1,775 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <chrono>
+#include <istream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <filesystem>
+#include <mutex>
+#include <future>
+#include <thread>
+#include <stdexcept>
+#include <Eigen/Dense>
+#include "Date.h"
+#include "Portfolio.h"
+#include "InforceFile.h"
+#include "ScenarioSet.h"
+#include "ScenarioReducer.h"
+#include "Rebalance.h"
+#include "SellProRata.h"
+#include "BuyBonds.h"
+#include "TaskExecutor.h"
+#include "ThreadPoolExecutor.h"
+#include "MultiScenarioProjection.h"
+#include "ShardedProjection.h"
+#include "ResultFile.h"
+#include "BoxConstraint.h"
+#include "TrustRegionSolver.h"
+#include "ProjectedGradientSolver.h"
+#include "Log.h"
+
+namespace ALM {
+
+    /**
+     * @brief One unit of work of a batch: inputs, strategy, what to solve and where to write it.
+     *
+     * Built by JobFile from a declarative description; see JobFile for the keys.
+     */
+    struct BatchJob {
+        enum class Mode {
+            Run,            ///< Solve the starting assets of every scenario
+            Max,            ///< Largest starting assets across scenarios (MultiScenarioProjection::runMax)
+            Optimize        ///< Asset volumes in [0, 1] minimizing the Max objective
+        };
+
+        enum class Solver {
+            TrustRegion,
+            ProjectedGradient
+        };
+
+        std::string name;
+        std::string assets;                             ///< Inforce file of the asset portfolio
+        std::string liabilities;                        ///< Inforce file of the liability portfolio
+        std::string scenarios;                          ///< Scenario cube file
+        Date start;
+        Date end;
+        Duration step = Duration(1, Duration::Unit::Months);
+        std::vector<BuyBonds::BondTemplate> buy;        ///< Reinvestment templates; shortfalls are sold pro rata
+        std::vector<size_t> sell;                       ///< What-if: asset indices taken out of the starting portfolio
+        size_t reduce = 0;                              ///< Project on this many representative scenarios; 0 for all
+        Mode mode = Mode::Run;
+        Solver solver = Solver::TrustRegion;
+        int iterations = 12;                            ///< Solver iterations for Mode::Optimize
+        size_t threads = 0;                             ///< Worker threads; 0 for the hardware concurrency
+        size_t processes = 0;                           ///< Worker processes sharing Mode::Run; 0 or 1 runs in-process
+        std::string results;                            ///< Optional ResultFile of every history (Mode::Run)
+        std::string summary;                            ///< Optional CSV of the job's per-scenario or per-asset values
+    };
+
+    /**
+     * @brief Parses batch job descriptions.
+     *
+     * A job file is a list of `key = value` lines grouped under `[job <name>]` headers. Lines
+     * before the first header are defaults for every job in the file; blank lines and text after
+     * `#` are ignored. Relative paths are resolved against the job file's directory.
+     *
+     *     assets      = inforce/assets.bin
+     *     liabilities = inforce/liabilities.bin
+     *     start       = 2025-12-31
+     *     horizon     = 30Y
+     *
+     *     [job base]
+     *     scenarios = scenarios/base.bin
+     *     buy       = 0.5 0.045 5Y, 0.5 0.050 10Y
+     *     mode      = max
+     *
+     * Keys: assets, liabilities, scenarios, start (YYYY-MM-DD), end (YYYY-MM-DD) or horizon,
+     * step (e.g. 1M, 1Y, 7D), buy (comma-separated `proportion coupon tenor` templates),
+     * sell (comma-separated asset indices), reduce (representative scenarios), mode (run, max,
+     * optimize), solver (trust-region, projected-gradient), iterations, threads, processes (run mode
+     * only; threads are then per process), results, summary.
+     */
+    class JobFile {
+    public:
+        /**
+         * @brief Read all jobs of a file.
+         * @throws std::runtime_error naming the file and line of the first malformed entry.
+         */
+        static std::vector<BatchJob> read(const std::string& path) {
+            std::ifstream in(path);
+            if (!in)
+                throw std::runtime_error("JobFile: cannot open " + path);
+            return parse(in, path, std::filesystem::path(path).parent_path().string());
+        }
+
+        /**
+         * @brief Parse jobs from a stream.
+         *
+         * @param source Name used in error messages.
+         * @param base_directory Directory that relative input and output paths are resolved against.
+         */
+        static std::vector<BatchJob> parse(std::istream& in, const std::string& source = "<job>", const std::string& base_directory = "") {
+            using Entries = std::map<std::string, std::pair<std::string, int>>;  // key -> (value, line)
+
+            Entries defaults;
+            std::vector<std::pair<std::string, Entries>> sections;
+            Entries* current = &defaults;
+
+            int number = 0;
+            for (std::string line; std::getline(in, line);) {
+                ++number;
+                line = trim(line.substr(0, line.find('#')));
+                if (line.empty()) continue;
+
+                if (line.front() == '[') {
+                    if (line.back() != ']' || line.compare(0, 4, "[job") != 0)
+                        fail(source, number, "expected [job <name>]");
+                    std::string name = trim(line.substr(4, line.size() - 5));
+                    if (name.empty())
+                        fail(source, number, "job without a name");
+                    sections.emplace_back(name, Entries());
+                    current = &sections.back().second;
+                    continue;
+                }
+
+                size_t equals = line.find('=');
+                if (equals == std::string::npos)
+                    fail(source, number, "expected key = value");
+                std::string key = trim(line.substr(0, equals));
+                if (!known(key))
+                    fail(source, number, "unknown key " + key);
+                (*current)[key] = { trim(line.substr(equals + 1)), number };
+            }
+
+            std::vector<BatchJob> jobs;
+            for (auto& [name, entries] : sections) {
+                Entries merged = entries;
+                merged.insert(defaults.begin(), defaults.end());  // job entries take precedence
+                jobs.push_back(build(name, merged, source, base_directory));
+            }
+            return jobs;
+        }
+
+        /// Date in YYYY-MM-DD form
+        static Date parseDate(const std::string& text) {
+            int year = 0, month = 0, day = 0;
+            char dash1 = 0, dash2 = 0;
+            std::istringstream ss(text);
+            ss >> year >> dash1 >> month >> dash2 >> day;
+            if (!ss || dash1 != '-' || dash2 != '-' || !(ss >> std::ws).eof()
+                || month < 1 || month > 12 || day < 1 || day > Date::daysInMonth(year, month))
+                throw std::invalid_argument("expected a YYYY-MM-DD date, got " + text);
+            return Date({ year, month, day });
+        }
+
+        /// Duration such as 7D, 1M or 30Y
+        static Duration parseDuration(const std::string& text) {
+            size_t used = 0;
+            int amount = 0;
+            try {
+                amount = std::stoi(text, &used);
+            }
+            catch (const std::exception&) {
+                used = 0;
+            }
+            if (used == 0 || used + 1 != text.size() || amount <= 0)
+                throw std::invalid_argument("expected a duration such as 1M or 30Y, got " + text);
+
+            switch (std::toupper(static_cast<unsigned char>(text.back()))) {
+            case 'D': return Duration(amount, Duration::Unit::Days);
+            case 'M': return Duration(amount, Duration::Unit::Months);
+            case 'Y': return Duration(amount, Duration::Unit::Years);
+            }
+            throw std::invalid_argument("expected a duration unit D, M or Y, got " + text);
+        }
+
+    private:
+        static bool known(const std::string& key) {
+            static const char* const keys[] = {
+                "assets", "liabilities", "scenarios", "start", "end", "horizon", "step", "buy", "sell",
+                "reduce", "mode", "solver", "iterations", "threads", "processes", "results", "summary" };
+            return std::find(std::begin(keys), std::end(keys), key) != std::end(keys);
+        }
+
+        template <typename Entries>
+        static BatchJob build(const std::string& name, const Entries& entries, const std::string& source, const std::string& base) {
+            BatchJob job;
+            job.name = name;
+
+            auto has = [&](const char* key) { return entries.count(key) > 0; };
+            auto value = [&](const char* key) -> const std::string& {
+                auto it = entries.find(key);
+                if (it == entries.end())
+                    throw std::runtime_error("JobFile: " + source + ": job " + name + " has no " + key);
+                return it->second.first;
+                };
+            // Converts with fn, reporting failures at the entry's line
+            auto with = [&](const char* key, auto fn) {
+                try {
+                    fn(value(key));
+                }
+                catch (const std::invalid_argument& e) {
+                    fail(source, entries.find(key)->second.second, e.what());
+                }
+                catch (const std::out_of_range&) {
+                    fail(source, entries.find(key)->second.second, std::string("value out of range for ") + key);
+                }
+                };
+            auto path = [&](const char* key) {
+                std::filesystem::path p(value(key));
+                return (p.is_relative() && !base.empty() ? std::filesystem::path(base) / p : p).string();
+                };
+
+            job.assets = path("assets");
+            job.liabilities = path("liabilities");
+            job.scenarios = path("scenarios");
+            with("start", [&](const std::string& v) { job.start = parseDate(v); });
+
+            if (has("end")) {
+                with("end", [&](const std::string& v) { job.end = parseDate(v); });
+            }
+            else {
+                with("horizon", [&](const std::string& v) { job.end = job.start + parseDuration(v); });
+            }
+            if (job.end <= job.start)
+                throw std::runtime_error("JobFile: " + source + ": job " + name + " ends before it starts");
+
+            if (has("step")) with("step", [&](const std::string& v) { job.step = parseDuration(v); });
+            if (has("buy")) with("buy", [&](const std::string& v) { job.buy = parseTemplates(v); });
+            if (has("sell")) with("sell", [&](const std::string& v) { job.sell = parseIndices(v); });
+            if (has("reduce")) with("reduce", [&](const std::string& v) { job.reduce = std::stoul(v); });
+            if (has("mode")) {
+                with("mode", [&](const std::string& v) {
+                    if (v == "run") job.mode = BatchJob::Mode::Run;
+                    else if (v == "max") job.mode = BatchJob::Mode::Max;
+                    else if (v == "optimize") job.mode = BatchJob::Mode::Optimize;
+                    else throw std::invalid_argument("expected mode run, max or optimize, got " + v);
+                    });
+            }
+            if (has("solver")) {
+                with("solver", [&](const std::string& v) {
+                    if (v == "trust-region") job.solver = BatchJob::Solver::TrustRegion;
+                    else if (v == "projected-gradient") job.solver = BatchJob::Solver::ProjectedGradient;
+                    else throw std::invalid_argument("expected solver trust-region or projected-gradient, got " + v);
+                    });
+            }
+            if (has("iterations")) with("iterations", [&](const std::string& v) { job.iterations = std::stoi(v); });
+            if (has("threads")) with("threads", [&](const std::string& v) { job.threads = std::stoul(v); });
+            if (has("processes")) with("processes", [&](const std::string& v) { job.processes = std::stoul(v); });
+            if (has("results")) job.results = path("results");
+            if (has("summary")) job.summary = path("summary");
+
+            if (!job.results.empty() && (job.mode != BatchJob::Mode::Run || job.reduce > 0))
+                throw std::runtime_error("JobFile: " + source + ": job " + name + " writes results only in run mode on all scenarios");
+            if (job.processes > 1 && job.mode != BatchJob::Mode::Run)
+                throw std::runtime_error("JobFile: " + source + ": job " + name + " runs in worker processes only in run mode");
+            return job;
+        }
+
+        static std::vector<BuyBonds::BondTemplate> parseTemplates(const std::string& text) {
+            std::vector<BuyBonds::BondTemplate> templates;
+            std::stringstream list(text);
+            for (std::string item; std::getline(list, item, ',');) {
+                std::istringstream fields(item);
+                double proportion = 0.0, coupon = 0.0;
+                std::string tenor;
+                if (!(fields >> proportion >> coupon >> tenor) || !(fields >> std::ws).eof())
+                    throw std::invalid_argument("expected buy templates as proportion coupon tenor, got " + trim(item));
+                templates.push_back({ proportion, coupon, parseDuration(tenor) });
+            }
+            return templates;
+        }
+
+        static std::vector<size_t> parseIndices(const std::string& text) {
+            std::vector<size_t> indices;
+            std::stringstream list(text);
+            for (std::string item; std::getline(list, item, ',');) {
+                item = trim(item);
+                if (item.empty() || item.find_first_not_of("0123456789") != std::string::npos)
+                    throw std::invalid_argument("expected comma-separated asset indices, got " + text);
+                indices.push_back(std::stoul(item));
+            }
+            return indices;
+        }
+
+        static std::string trim(const std::string& text) {
+            size_t first = text.find_first_not_of(" \t\r");
+            if (first == std::string::npos) return "";
+            size_t last = text.find_last_not_of(" \t\r");
+            return text.substr(first, last - first + 1);
+        }
+
+        [[noreturn]] static void fail(const std::string& source, int line, const std::string& message) {
+            throw std::runtime_error("JobFile: " + source + ":" + std::to_string(line) + ": " + message);
+        }
+    };
+
+    /**
+     * @brief Values of one projected scenario of a run job.
+     */
+    struct ScenarioValue {
+        size_t scenario = 0;            ///< Index in the job's scenario set
+        double starting_assets = 0.0;   ///< Solved starting asset value (assets_bop[0])
+        double ending_surplus = 0.0;
+        double weight = 0.0;            ///< Share of the scenario set it stands for
+    };
+
+    /**
+     * @brief What a batch job produced.
+     */
+    struct BatchOutcome {
+        std::string name;
+        double value = 0.0;             ///< Largest starting asset value (run, max) or optimized objective
+        double mean = 0.0;              ///< Weighted mean starting asset value over completed scenarios (run)
+        size_t scenarios = 0;           ///< Scenarios projected: the whole set, or its representatives
+        size_t completed = 0;           ///< Scenarios whose projections finished
+        int iterations = 0;             ///< Solver iterations (optimize)
+        bool success = true;            ///< False if the optimizer did not converge
+        double seconds = 0.0;           ///< Wall-clock time, excluding inputs already cached
+        std::vector<ScenarioValue> details;     ///< One entry per completed scenario (run), or the scenario attaining the maximum (max)
+        std::vector<double> volumes;            ///< Optimized volume of each asset (optimize)
+    };
+
+    /**
+     * @brief Runs batch jobs, keeping what they share between jobs.
+     *
+     * Thread pools are kept per thread count, inforce files and scenario cubes per path (reloaded
+     * when the file changes on disk), scenario reductions per set, size and horizon, and each
+     * scenario set's worst-first order from max jobs seeds later max and optimize jobs on it.
+     * Jobs may run concurrently from several threads; an input is loaded once and then shared.
+     */
+    class BatchRunner {
+    public:
+        BatchRunner() = default;
+
+        /**
+         * @brief Runs every job on one executor whatever its thread setting, e.g. a pool shared
+         *        fairly between the clients of a service.
+         */
+        explicit BatchRunner(std::shared_ptr<TaskExecutor> executor)
+            : shared_(std::move(executor)) {
+        }
+
+        BatchRunner(const BatchRunner&) = delete;
+        BatchRunner& operator=(const BatchRunner&) = delete;
+
+        /**
+         * @brief Run one job and write its requested outputs.
+         * @throws std::runtime_error if an input cannot be read or an output cannot be written.
+         * @throws std::invalid_argument if the job sells an asset the portfolio does not have.
+         */
+        BatchOutcome run(const BatchJob& job) {
+            auto t0 = std::chrono::steady_clock::now();
+
+            BatchOutcome outcome;
+            outcome.name = job.name;
+
+            switch (job.mode) {
+            case BatchJob::Mode::Run:
+                runAll(job, outcome);
+                break;
+            case BatchJob::Mode::Max:
+                runMax(job, outcome);
+                break;
+            case BatchJob::Mode::Optimize:
+                optimize(job, outcome);
+                break;
+            }
+
+            outcome.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+            ALM_LOG_INFO("job {}: {} of {} scenarios in {}s", job.name, outcome.completed, outcome.scenarios, outcome.seconds);
+            return outcome;
+        }
+
+        /// Drops all cached inputs; thread pools are kept
+        void clearCache() {
+            std::lock_guard lock(mutex_);
+            portfolios_.clear();
+            scenario_sets_.clear();
+            reductions_.clear();
+            orders_.clear();
+        }
+
+    private:
+        template <typename T>
+        struct Cached {
+            std::shared_future<T> value;    // Ready once the first caller's load finishes
+            std::filesystem::file_time_type modified;
+            uintmax_t size = 0;
+        };
+
+        struct Reduction {
+            std::shared_ptr<const ScenarioSet> set;             // Keeps the curve views valid
+            std::shared_future<std::shared_ptr<const ReducedScenarios>> reduced;
+        };
+
+        /// The curves a job projects on: a scenario set or its representatives
+        struct Scenarios {
+            std::shared_ptr<const ScenarioSet> set;
+            std::shared_ptr<const ReducedScenarios> reduced;    // Null for the whole set
+            std::string key;                                    // Key of the worst-first order
+
+            size_t size() const { return reduced ? reduced->medoids.size() : set->size(); }
+            size_t original(size_t i) const { return reduced ? reduced->medoids[i] : i; }
+            double weight(size_t i) const { return reduced ? reduced->weights[i] : 1.0 / static_cast<double>(set->size()); }
+        };
+
+        std::shared_ptr<TaskExecutor> shared_;
+
+        std::mutex mutex_;      // Guards the caches; loads and reductions run outside it
+        std::map<size_t, std::shared_ptr<TaskExecutor>> executors_;
+        std::map<std::string, Cached<std::shared_ptr<const Portfolio>>> portfolios_;
+        std::map<std::string, Cached<std::shared_ptr<const ScenarioSet>>> scenario_sets_;
+        std::map<std::string, Reduction> reductions_;           // set|k|start|end -> representatives
+        std::map<std::string, std::vector<size_t>> orders_;     // Scenarios::key -> worst-first order
+
+        std::shared_ptr<TaskExecutor> executor(size_t threads) {
+            if (shared_) return shared_;
+            if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+            std::lock_guard lock(mutex_);
+            auto& executor = executors_[threads];
+            if (!executor) executor = std::make_shared<ThreadPoolExecutor>(threads);
+            return executor;
+        }
+
+        // Loads through the cache unless the file changed since it was cached. The first caller
+        // for a file version loads it outside mutex_, so jobs on other inputs are not held up;
+        // concurrent callers for the same version wait for that load. Failed loads are not cached.
+        template <typename T, typename Load>
+        T cached(std::map<std::string, Cached<T>>& cache, const std::string& path, Load load) {
+            std::error_code error;
+            auto modified = std::filesystem::last_write_time(path, error);
+            uintmax_t size = error ? 0 : std::filesystem::file_size(path, error);
+            if (error) return load();
+
+            std::promise<T> promise;
+            std::shared_future<T> value;
+            bool loading = false;
+            {
+                std::lock_guard lock(mutex_);
+                auto it = cache.find(path);
+                if (it != cache.end() && it->second.modified == modified && it->second.size == size) {
+                    value = it->second.value;
+                }
+                else {
+                    value = promise.get_future().share();
+                    cache[path] = { value, modified, size };
+                    loading = true;
+                }
+            }
+
+            if (loading && !fulfil(promise, load)) {
+                std::lock_guard lock(mutex_);
+                auto it = cache.find(path);
+                if (it != cache.end() && it->second.modified == modified && it->second.size == size)
+                    cache.erase(it);
+            }
+            return value.get();
+        }
+
+        // Stores make()'s result or exception in the promise; false if make() threw
+        template <typename T, typename Make>
+        static bool fulfil(std::promise<T>& promise, Make& make) {
+            try {
+                promise.set_value(make());
+                return true;
+            }
+            catch (...) {
+                promise.set_exception(std::current_exception());
+                return false;
+            }
+        }
+
+        std::shared_ptr<const Portfolio> portfolio(const std::string& path) {
+            return cached(portfolios_, path, [&path]() {
+                return std::make_shared<const Portfolio>(InforceFile(path).toPortfolio());
+                });
+        }
+
+        /// The job's asset portfolio with its sold assets taken out
+        Portfolio startingAssets(const BatchJob& job) {
+            Portfolio assets = *portfolio(job.assets);
+            sell(job, assets);
+            return assets;
+        }
+
+        static void sell(const BatchJob& job, Portfolio& assets) {
+            for (size_t i : job.sell) {
+                if (i >= assets.size())
+                    throw std::invalid_argument("BatchRunner: job " + job.name + " sells asset " + std::to_string(i)
+                        + " of a portfolio of " + std::to_string(assets.size()));
+                assets.assets()[i].setVolume(0.0);
+            }
+        }
+
+        // A reloaded scenario set invalidates its reductions and worst-first orders. Like loads,
+        // a reduction runs outside mutex_ and jobs asking for the same one wait for it.
+        Scenarios scenarios(const BatchJob& job) {
+            std::shared_ptr<TaskExecutor> pool = executor(job.threads);
+            auto set = cached(scenario_sets_, job.scenarios, [this, &job]() {
+                auto set = std::make_shared<const ScenarioSet>(job.scenarios);
+                std::lock_guard lock(mutex_);
+                std::erase_if(orders_, [&job](const auto& entry) { return entry.first.rfind(job.scenarios, 0) == 0; });
+                std::erase_if(reductions_, [&job](const auto& entry) { return entry.first.rfind(job.scenarios, 0) == 0; });
+                return set;
+                });
+
+            Scenarios scenarios{ set, nullptr, job.scenarios };
+            if (job.reduce == 0 || job.reduce >= set->size())
+                return scenarios;
+
+            std::string key = job.scenarios + "|" + std::to_string(job.reduce) + "|"
+                + std::to_string(job.start.serial()) + "|" + std::to_string(job.end.serial());
+            std::promise<std::shared_ptr<const ReducedScenarios>> promise;
+            std::shared_future<std::shared_ptr<const ReducedScenarios>> reduced;
+            bool reducing = false;
+            {
+                std::lock_guard lock(mutex_);
+                Reduction& reduction = reductions_[key];
+                if (reduction.set != set || !reduction.reduced.valid()) {
+                    reduction.set = set;
+                    reduction.reduced = promise.get_future().share();
+                    reducing = true;
+                }
+                reduced = reduction.reduced;
+            }
+
+            auto make = [&job, &set, &pool]() { return reduce(job, *set, pool); };
+            if (reducing && !fulfil(promise, make)) {
+                std::lock_guard lock(mutex_);
+                auto it = reductions_.find(key);
+                if (it != reductions_.end() && it->second.set == set)
+                    reductions_.erase(it);
+            }
+            scenarios.reduced = reduced.get();
+            scenarios.key = key;
+            return scenarios;
+        }
+
+        // Representatives clustered on annual discount factors over the projection horizon
+        static std::shared_ptr<const ReducedScenarios> reduce(const BatchJob& job, const ScenarioSet& set, std::shared_ptr<TaskExecutor> pool) {
+            std::vector<std::shared_ptr<YieldCurve>> curves;
+            curves.reserve(set.size());
+            for (size_t i = 0; i < set.size(); ++i) {
+                curves.push_back(std::make_shared<ScenarioCurve>(set.curve(i)));
+            }
+
+            int years = std::max(1, job.end.year() - job.start.year());
+            ScenarioReducer reducer(
+                ScenarioReducer::featureDates(set.reference(), Duration(years, Duration::Unit::Years)),
+                std::move(pool));
+            return std::make_shared<const ReducedScenarios>(reducer.reduce(curves, job.reduce));
+        }
+
+        std::vector<size_t> order(const std::string& key) {
+            std::lock_guard lock(mutex_);
+            return orders_[key];
+        }
+
+        void setOrder(const std::string& key, std::vector<size_t> order) {
+            std::lock_guard lock(mutex_);
+            orders_[key] = std::move(order);
+        }
+
+        static std::shared_ptr<Strategy> strategy(const BatchJob& job) {
+            return std::make_shared<Rebalance<SellProRata, BuyBonds>>(SellProRata(), BuyBonds(job.buy));
+        }
+
+        MultiScenarioProjection projection(
+            const BatchJob& job, Portfolio assets, const Portfolio& liabilities,
+            const Scenarios& scenarios, std::shared_ptr<TaskExecutor> executor) {
+            if (scenarios.reduced) {
+                return MultiScenarioProjection(std::move(assets), liabilities, strategy(job), std::move(executor),
+                    scenarios.reduced->curves, job.start, job.end, job.step);
+            }
+            return MultiScenarioProjection(std::move(assets), liabilities, strategy(job), std::move(executor),
+                scenarios.set, job.start, job.end, job.step);
+        }
+
+        void runAll(const BatchJob& job, BatchOutcome& outcome) {
+            Scenarios scenarios = this->scenarios(job);
+            outcome.scenarios = scenarios.size();
+
+            std::vector<ProjectionResult> results;
+            auto runOn = [&](auto& projection) {
+                if (job.results.empty()) {
+                    results = projection.run();
+                    return;
+                }
+                ResultWriter writer(job.results);
+                projection.run(writer);
+                writer.close();
+
+                ResultFile file(job.results);
+                results.resize(projection.size());
+                for (size_t k = 0; k < file.size(); ++k) {
+                    ResultRecord record = file.record(k);
+                    results[record.scenario].assets_bop.assign(1, record.assets_bop.front());
+                    results[record.scenario].ending_surplus = record.ending_surplus;
+                }
+                };
+
+            if (job.processes > 1) {
+                // Inputs are loaded here, before the fork, so workers only copy them
+                Portfolio assets = startingAssets(job);
+                std::shared_ptr<const Portfolio> liabilities = portfolio(job.liabilities);
+                size_t threads = job.threads != 0 ? job.threads
+                    : std::max<size_t>(1, std::thread::hardware_concurrency() / job.processes);
+                ShardedProjection projection(
+                    [&](std::shared_ptr<TaskExecutor> executor) {
+                        return this->projection(job, assets, *liabilities, scenarios, std::move(executor));
+                    },
+                    scenarios.size(), job.start, job.end, job.step, job.processes, threads);
+                runOn(projection);
+            }
+            else {
+                MultiScenarioProjection projection = this->projection(
+                    job, startingAssets(job), *portfolio(job.liabilities), scenarios, executor(job.threads));
+                runOn(projection);
+            }
+
+            double weight = 0.0;
+            for (size_t i = 0; i < results.size(); ++i) {
+                if (results[i].assets_bop.empty()) continue;
+                ScenarioValue value{ scenarios.original(i), results[i].assets_bop.front(), results[i].ending_surplus, scenarios.weight(i) };
+                outcome.value = std::max(outcome.value, value.starting_assets);
+                outcome.mean += value.weight * value.starting_assets;
+                weight += value.weight;
+                outcome.details.push_back(value);
+            }
+            outcome.completed = outcome.details.size();
+            if (weight > 0.0) outcome.mean /= weight;
+
+            std::ofstream summary = open(job.summary);
+            if (summary.is_open()) {
+                summary << "scenario,starting_assets,ending_surplus,weight\n" << std::setprecision(17);
+                for (const ScenarioValue& value : outcome.details) {
+                    summary << value.scenario << ',' << value.starting_assets << ',' << value.ending_surplus << ',' << value.weight << '\n';
+                }
+            }
+            close(summary, job.summary);
+        }
+
+        void runMax(const BatchJob& job, BatchOutcome& outcome) {
+            Scenarios scenarios = this->scenarios(job);
+            MultiScenarioProjection projection = this->projection(
+                job, startingAssets(job), *portfolio(job.liabilities), scenarios, executor(job.threads));
+            outcome.scenarios = scenarios.size();
+
+            MaxReduction reduction = projection.runMax(order(scenarios.key));
+            setOrder(scenarios.key, reduction.order);
+            outcome.value = reduction.maximum;
+            outcome.completed = reduction.solved + reduction.pruned;
+            if (!reduction.result.assets_bop.empty()) {
+                outcome.details.push_back({ scenarios.original(reduction.scenario), reduction.maximum,
+                    reduction.result.ending_surplus, scenarios.weight(reduction.scenario) });
+            }
+
+            std::ofstream summary = open(job.summary);
+            if (summary.is_open()) {
+                summary << "scenario,starting_assets,solved,pruned\n" << std::setprecision(17)
+                    << scenarios.original(reduction.scenario) << ',' << reduction.maximum << ','
+                    << reduction.solved << ',' << reduction.pruned << '\n';
+            }
+            close(summary, job.summary);
+        }
+
+        void optimize(const BatchJob& job, BatchOutcome& outcome) {
+            Portfolio assets = startingAssets(job);
+            auto liabilities = portfolio(job.liabilities);
+            Scenarios scenarios = this->scenarios(job);
+            auto pool = executor(job.threads);
+            const std::vector<size_t> order = this->order(scenarios.key);
+            outcome.scenarios = scenarios.size();
+
+            auto n = static_cast<Eigen::Index>(assets.size());
+            std::vector<std::shared_ptr<Constraint>> constraints = {
+                std::make_shared<BoxConstraint>(Eigen::VectorXd::Zero(n), Eigen::VectorXd::Ones(n)) };
+
+            auto f = [&](const Eigen::VectorXd& x) {
+                Portfolio portfolio = assets;
+                for (Eigen::Index i = 0; i < x.size(); ++i) {
+                    portfolio.assets()[i].setVolume(x[i]);
+                }
+                sell(job, portfolio);
+                MultiScenarioProjection projection = this->projection(job, std::move(portfolio), *liabilities, scenarios, pool);
+
+                // The order only speeds the search; the maximum is run()'s, so finite differences
+                // see no solver noise. It stays fixed so no evaluation depends on an earlier one.
+                return projection.runMax(order).maximum;
+                };
+
+            std::unique_ptr<SolverXd> solver;
+            if (job.solver == BatchJob::Solver::TrustRegion)
+                solver = std::make_unique<TrustRegionSolver>(constraints, job.iterations);
+            else
+                solver = std::make_unique<ProjectedGradientSolver>(constraints, job.iterations);
+
+            SolverXdResults result = solver->solve(f, Eigen::VectorXd::Ones(n));
+            outcome.value = result.objective;
+            outcome.iterations = result.iterations;
+            outcome.success = result.success;
+            outcome.completed = scenarios.size();
+            outcome.volumes.assign(result.x.data(), result.x.data() + result.x.size());
+
+            std::ofstream summary = open(job.summary);
+            if (summary.is_open()) {
+                summary << "asset,volume\n" << std::setprecision(17);
+                for (size_t i = 0; i < outcome.volumes.size(); ++i) {
+                    summary << i << ',' << outcome.volumes[i] << '\n';
+                }
+            }
+            close(summary, job.summary);
+        }
+
+        // Unopened stream if no path was requested
+        static std::ofstream open(const std::string& path) {
+            std::ofstream out;
+            if (path.empty()) return out;
+            out.open(path, std::ios::trunc);
+            if (!out)
+                throw std::runtime_error("BatchRunner: cannot open " + path);
+            return out;
+        }
+
+        static void close(std::ofstream& out, const std::string& path) {
+            if (path.empty()) return;
+            out.close();
+            if (!out)
+                throw std::runtime_error("BatchRunner: write failed for " + path);
+        }
+    };
+
+}
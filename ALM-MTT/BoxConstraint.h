@@ -24,7 +24,7 @@
 
 #pragma once
 
-#include <Eigen/dense>
+#include <Eigen/Dense>
 #include "Constraint.h"
 
 namespace ALM {
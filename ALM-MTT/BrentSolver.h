@@ -1,18 +1,34 @@
 #pragma once
 
 #include <cmath>
+#include <algorithm>
+#include <functional>
 #include <stdexcept>
 #include <limits>
+#include "Trace.h"
 
 namespace ALM {
 
     class BrentSolver {
     public:
-        BrentSolver(int max_iter = 100, double tol = 1e-6)
+        /// Default absolute tolerance on the root; the returned root is within about this of the true one
+        static constexpr double DefaultTolerance = 1e-6;
+
+        BrentSolver(int max_iter = 100, double tol = DefaultTolerance)
             : max_iter_(max_iter), tol_(tol) {
         }
 
-        double solve(const std::function<double(double)>& f, double lower, double upper, double guess = 0.0) {
+        /**
+         * @param abandon Optional check on the current bracket [low, high], which always holds the
+         *                root; once it returns true the solve stops and returns NaN.
+         */
+        double solve(
+            const std::function<double(double)>& f,
+            double lower,
+            double upper,
+            double guess = 0.0,
+            const std::function<bool(double, double)>& abandon = nullptr) {
+            ALM_TRACE_SCOPE("solver", "BrentSolver::solve");
             constexpr double eps = std::numeric_limits<double>::epsilon();
 
             double a = lower, b = upper;
@@ -28,15 +44,21 @@ namespace ALM {
             double fs = fb;
 
             for (int iter = 0; iter < max_iter_; ++iter) {
+                ALM_TRACE_SCOPE("solver", "BrentSolver::iteration");
                 if (std::abs(fc) < std::abs(fb)) {
                     a = b; b = c; c = a;
                     fa = fb; fb = fc; fc = fa;
                 }
 
+                if (abandon && abandon(std::min(b, c), std::max(b, c))) {
+                    return std::numeric_limits<double>::quiet_NaN();
+                }
+
                 const double tol1 = 2 * eps * std::abs(b) + 0.5 * tol_;
                 const double m = 0.5 * (c - b);
 
                 if (std::abs(m) <= tol1 || fb == 0.0) {
+                    ALM_TRACE_COUNTER("solver", "BrentSolver::iterations", iter);
                     return b;
                 }
 
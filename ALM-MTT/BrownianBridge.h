@@ -0,0 +1,130 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include <stdexcept>
+
+namespace ALM {
+
+    /**
+     * @brief Brownian-bridge path construction on a fixed time grid.
+     *
+     * The first input draw sets the Brownian motion at the final time, the second at the
+     * midpoint, and so on by bisection, so the leading draws carry most of the path's variance.
+     * Paired with a low-discrepancy sequence this concentrates the sequence's best-distributed
+     * dimensions on the coarse shape of the path (the bridge of Jäckel, Monte Carlo Methods in
+     * Finance, 2002). The output is the per-step standardised increments, equal in distribution
+     * to the input, so it can replace step-by-step draws directly.
+     */
+    class BrownianBridge {
+    public:
+        /**
+         * @param step_lengths Length of each step; all positive.
+         */
+        explicit BrownianBridge(const std::vector<double>& step_lengths)
+            : size_(step_lengths.size()),
+            times_(size_), sqrt_dt_(size_),
+            bridge_(size_), left_(size_), right_(size_),
+            left_weight_(size_), right_weight_(size_), stdev_(size_) {
+            if (size_ == 0)
+                throw std::invalid_argument("BrownianBridge: need at least one step");
+
+            double t = 0.0;
+            for (size_t i = 0; i < size_; ++i) {
+                if (!(step_lengths[i] > 0.0))
+                    throw std::invalid_argument("BrownianBridge: step lengths must be positive");
+                t += step_lengths[i];
+                times_[i] = t;
+                sqrt_dt_[i] = std::sqrt(step_lengths[i]);
+            }
+
+            // map[i] != 0 once point i is constructed; the terminal point comes first
+            std::vector<size_t> map(size_, 0);
+            map[size_ - 1] = 1;
+            bridge_[0] = size_ - 1;
+            stdev_[0] = std::sqrt(times_[size_ - 1]);
+
+            size_t j = 0;
+            for (size_t i = 1; i < size_; ++i) {
+                while (map[j]) ++j;          // first point not yet constructed
+                size_t k = j;
+                while (!map[k]) ++k;         // next constructed point to its right
+                size_t l = j + ((k - 1 - j) >> 1);
+                map[l] = i;
+
+                bridge_[i] = l;
+                left_[i] = j;
+                right_[i] = k;
+                double t_left = j ? times_[j - 1] : 0.0;
+                double span = times_[k] - t_left;
+                left_weight_[i] = (times_[k] - times_[l]) / span;
+                right_weight_[i] = (times_[l] - t_left) / span;
+                stdev_[i] = std::sqrt((times_[l] - t_left) * (times_[k] - times_[l]) / span);
+
+                j = k + 1;
+                if (j >= size_) j = 0;
+            }
+        }
+
+        size_t size() const {
+            return size_;
+        }
+
+        /**
+         * @brief Turns independent standard normals, in order of importance, into standardised
+         *        path increments (step i of the Brownian path is sqrt(dt_i) * out[i]).
+         *
+         * @param in size() standard normals.
+         * @param out size() standard normals; may not alias in.
+         */
+        void transform(const double* in, double* out) const {
+            // Build the path in out, then difference it in place
+            out[size_ - 1] = stdev_[0] * in[0];
+            for (size_t i = 1; i < size_; ++i) {
+                size_t j = left_[i], k = right_[i], l = bridge_[i];
+                double left = j ? out[j - 1] : 0.0;
+                out[l] = left_weight_[i] * left + right_weight_[i] * out[k] + stdev_[i] * in[i];
+            }
+            for (size_t i = size_ - 1; i > 0; --i) {
+                out[i] = (out[i] - out[i - 1]) / sqrt_dt_[i];
+            }
+            out[0] /= sqrt_dt_[0];
+        }
+
+    private:
+        size_t size_;
+        std::vector<double> times_;         // cumulative time at the end of each step
+        std::vector<double> sqrt_dt_;
+        std::vector<size_t> bridge_;        // point constructed by draw i
+        std::vector<size_t> left_;          // first point after the left anchor (0: anchor is time 0)
+        std::vector<size_t> right_;         // right anchor point
+        std::vector<double> left_weight_;
+        std::vector<double> right_weight_;
+        std::vector<double> stdev_;
+    };
+
+}
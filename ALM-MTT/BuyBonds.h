@@ -30,7 +30,6 @@
 #include "Date.h"
 #include "YieldCurve.h"
 #include "Strategy.h"
-#include "BrentSolver.h"
 
 namespace ALM {
 
@@ -38,9 +37,10 @@ namespace ALM {
      * @brief Strategy that reinvests available cash into fixed-rate bonds using predefined templates.
      *
      * Bonds are purchased in proportions specified by the strategy. Each template defines the
-     * percentage of available cash to use, the coupon rate, and the bond tenor.
+     * percentage of available cash to use, the coupon rate, and the bond tenor. Purchases of a
+     * template on the same semi-annual coupon date grid are held as one lot, see Portfolio::addLot.
      */
-    class BuyBonds : public Strategy {
+    class BuyBonds final : public Strategy {
         using CurveHandle = RelinkableHandle<YieldCurve>;
 
     public:
@@ -68,39 +68,49 @@ namespace ALM {
         void apply(
             Portfolio& portfolio,
             double& cash,
-            Date step_start,
-            Date step_end,
+            StepContext& step,
             const std::shared_ptr<const YieldCurve>& curve) override
+        {
+            apply(portfolio, cash, step, *curve);
+        }
+
+        /**
+         * @brief Statically dispatched form used by ProjectionKernel.
+         */
+        template <YieldCurveType Curve>
+        void apply(
+            Portfolio& portfolio,
+            double& cash,
+            StepContext& step,
+            const Curve& curve)
         {
             if (cash <= 0.0)
                 return;
 
-            BrentSolver solver;
+            YearMonthDay issue = step.step_start.toYMD();
 
-            for (const auto& bond_template : templates_) {
+            for (size_t t = 0; t < templates_.size(); ++t) {
+                const BondTemplate& bond_template = templates_[t];
                 double amount = cash * bond_template.proportion;
                 if (amount < 1e-6) continue;  // Skip tiny allocations
 
-                auto f = [&](double x) {
-                    Asset bond = Asset(CashFlowBuilder::fixedRateBond(
-                        step_start,
-                        step_start + bond_template.tenor,
-                        bond_template.coupon,
-                        x));
-
-                    return bond.marketValue(curve, step_start) - amount;
-
-                    };
-
-                double notional = solver.solve(f, 0.0, 1e10, amount);
-
+                // Price a unit-notional bond; value is linear in notional, so the
+                // purchased volume follows directly.
                 Asset bond = Asset(CashFlowBuilder::fixedRateBond(
-                    step_start,
-                    step_start + bond_template.tenor,
+                    step.step_start,
+                    step.step_start + bond_template.tenor,
                     bond_template.coupon,
-                    notional));
+                    1.0,
+                    Duration(CouponMonths, Duration::Unit::Months)));
+
+                double unit_price = bond.marketValue(curve, step.step_start);
+                if (unit_price <= 0.0) continue;
 
-                portfolio.addAsset(std::move(bond));
+                bond.setVolume(amount / unit_price);
+                // Bonds issued on the same day of the coupon period pay on the same dates
+                size_t grid = static_cast<size_t>((issue.month - 1) % CouponMonths) * 31 + static_cast<size_t>(issue.day - 1);
+                portfolio.addLot(std::move(bond), t * CouponMonths * 31 + grid);
+                step.assets_mv += amount;
                 cash -= amount;
             }
 
@@ -109,6 +119,8 @@ namespace ALM {
         }
 
     private:
+        static constexpr int CouponMonths = 6;
+
         std::vector<BondTemplate> templates_;  ///< List of bond reinvestment targets
     };
 
@@ -0,0 +1,133 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+
+namespace ALM {
+
+    /**
+     * @brief Thrown from a task that observes its cancellation token has fired.
+     */
+    class OperationCancelled : public std::runtime_error {
+    public:
+        OperationCancelled() : std::runtime_error("Operation cancelled") {}
+    };
+
+    /**
+     * @brief Read-only view of a cancellation request, passed to the work that should stop.
+     *
+     * A token fires once its source is cancelled or its deadline passes. A default-constructed
+     * token has no source and never fires, so checking it costs a null test. Tokens are cheap
+     * to copy and safe to check from any thread.
+     */
+    class CancellationToken {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        CancellationToken() = default;
+
+        bool cancelled() const {
+            if (!state_) return false;
+            if (state_->cancelled.load(std::memory_order_relaxed)) return true;
+
+            auto deadline = state_->deadline.load(std::memory_order_relaxed);
+            if (deadline != Clock::time_point::max().time_since_epoch().count()
+                && Clock::now().time_since_epoch().count() >= deadline) {
+                state_->cancelled.store(true, std::memory_order_relaxed);
+                return true;
+            }
+            return false;
+        }
+
+        /// Throws OperationCancelled if the token has fired
+        void throwIfCancelled() const {
+            if (cancelled()) throw OperationCancelled();
+        }
+
+        /// False for a default-constructed token that can never fire
+        bool cancellable() const {
+            return static_cast<bool>(state_);
+        }
+
+    private:
+        friend class CancellationSource;
+
+        struct State {
+            std::atomic<bool> cancelled{ false };
+            std::atomic<Clock::rep> deadline{ Clock::time_point::max().time_since_epoch().count() };
+        };
+
+        explicit CancellationToken(std::shared_ptr<State> state) : state_(std::move(state)) {}
+
+        std::shared_ptr<State> state_;
+    };
+
+    /**
+     * @brief Issues tokens and requests cancellation, immediately or at a deadline.
+     *
+     * Mirrors std::stop_source, with a time budget added: cancelAfter() makes every token fire
+     * once the budget has elapsed, without a timer thread; the deadline is checked whenever a
+     * token is.
+     */
+    class CancellationSource {
+    public:
+        CancellationSource() : state_(std::make_shared<CancellationToken::State>()) {}
+
+        CancellationToken token() const {
+            return CancellationToken(state_);
+        }
+
+        void cancel() {
+            state_->cancelled.store(true, std::memory_order_relaxed);
+        }
+
+        /// Fires the tokens at the given time, or earlier if a deadline is already set
+        void cancelAt(CancellationToken::Clock::time_point deadline) {
+            auto ticks = deadline.time_since_epoch().count();
+            auto current = state_->deadline.load(std::memory_order_relaxed);
+            while (ticks < current && !state_->deadline.compare_exchange_weak(current, ticks, std::memory_order_relaxed)) {
+            }
+        }
+
+        /// Fires the tokens once the budget has elapsed from now
+        template <typename Rep, typename Period>
+        void cancelAfter(std::chrono::duration<Rep, Period> budget) {
+            cancelAt(CancellationToken::Clock::now()
+                + std::chrono::duration_cast<CancellationToken::Clock::duration>(budget));
+        }
+
+        bool cancelled() const {
+            return token().cancelled();
+        }
+
+    private:
+        std::shared_ptr<CancellationToken::State> state_;
+    };
+
+}
@@ -47,6 +47,10 @@ namespace ALM {
         bool occursBetween(const Date& from, const Date& to) const {
             return date > from && date <= to;
         }
+
+        bool operator==(const CashFlow& rhs) const {
+            return date == rhs.date && amount == rhs.amount;
+        }
     };
 
 }
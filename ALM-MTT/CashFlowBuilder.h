@@ -29,6 +29,7 @@
 #include "CashFlow.h"
 #include "Calendar.h"
 #include "Schedule.h"
+#include "DayCounter.h"
 
 namespace ALM {
 
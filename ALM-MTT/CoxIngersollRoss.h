@@ -0,0 +1,90 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <algorithm>
+#include "Date.h"
+#include "DayCounter.h"
+#include "ShortRateModel.h"
+
+namespace ALM {
+
+    /**
+     * @brief Cox-Ingersoll-Ross model dr = a (b - r) dt + sigma sqrt(r) dW.
+     *
+     * Stepped with the full-truncation Euler scheme (Lord, Koekkoek and van Dijk): the state may
+     * go negative but only its positive part enters the drift, diffusion and short rate, which
+     * keeps rates non-negative with the smallest bias among simple Euler fixes.
+     */
+    class CoxIngersollRoss final : public ShortRateModel {
+    public:
+        /**
+         * @param a Mean reversion speed.
+         * @param b Long-run mean rate.
+         * @param sigma Volatility scale; 0 gives deterministic rates.
+         * @param r0 Initial short rate.
+         */
+        CoxIngersollRoss(double a, double b, double sigma, double r0)
+            : a_(a), b_(b), sigma_(sigma), r0_(r0) {
+        }
+
+        double initialState() const override {
+            return r0_;
+        }
+
+        double evolve(double x, double dt, double z) const override {
+            double r = std::max(x, 0.0);
+            return x + a_ * (b_ - r) * dt + sigma_ * std::sqrt(r * dt) * z;
+        }
+
+        double shortRate(double x) const override {
+            return std::max(x, 0.0);
+        }
+
+        double discount(const Date& ref, const Date& t, const DayCounter& dc) const override {
+            double T = dc.yearFraction(ref, t);
+            if (sigma_ == 0.0) {
+                // Deterministic limit: r follows dr = a (b - r) dt exactly
+                double B = a_ == 0.0 ? T : -std::expm1(-a_ * T) / a_;
+                return std::exp(b_ * (B - T) - B * r0_);
+            }
+
+            double h = std::sqrt(a_ * a_ + 2.0 * sigma_ * sigma_);
+            double growth = std::expm1(h * T);
+            double denom = 2.0 * h + (a_ + h) * growth;
+            double A = std::pow(2.0 * h * std::exp(0.5 * (a_ + h) * T) / denom, 2.0 * a_ * b_ / (sigma_ * sigma_));
+            double B = 2.0 * growth / denom;
+            return A * std::exp(-B * r0_);
+        }
+
+    private:
+        double a_;
+        double b_;
+        double sigma_;
+        double r0_;
+    };
+
+}
@@ -23,7 +23,7 @@ namespace ALM {
 				return thirty360(start, end);
 			}
 		}
-		virtual int dayCount(const Date& start, const Date& end) const {
+		int dayCount(const Date& start, const Date& end) const {
 			return end.serial() - start.serial();
 		}
 	private:
@@ -7,14 +7,14 @@
 
 namespace ALM {
 
-	class FlatForward : public YieldCurve {
+	class FlatForward final : public YieldCurve {
 	public:
 		FlatForward(const Date& ref, double rate, DayCounter dc) :
-			ref_(ref), rate_(rate), dc_(dc) { }
+			ref_(ref), rate_(rate), log_growth_(std::log1p(rate)), dc_(dc) { }
 
 		double discount(const Date& t) const override {
 			double yf = dc_.yearFraction(ref_, t);
-			return std::pow(1 + rate_, -yf);
+			return std::exp(-yf * log_growth_);  // (1 + rate)^-yf
 		}
 		virtual double zero(const Date& t) const override {
 			return rate_;
@@ -22,12 +22,13 @@ namespace ALM {
 		virtual double forward(const Date& t1, const Date& t2) const override {
 			return rate_;
 		}
-		virtual Date reference() const {
+		virtual Date reference() const override {
 			return ref_;
 		}
 	private:
 		Date ref_;
 		double rate_;
+		double log_growth_;  // log(1 + rate_)
 		DayCounter dc_;
 	};
 
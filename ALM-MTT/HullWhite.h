@@ -0,0 +1,89 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "ShortRateModel.h"
+#include "YieldCurve.h"
+
+namespace ALM {
+
+    /**
+     * @brief Hull-White model dr = (theta(t) - a r) dt + sigma dW fitted to an initial curve.
+     *
+     * Simulated as r(t) = x(t) + alpha(t) with x a zero-mean Ornstein-Uhlenbeck process and
+     * alpha(t) = f(0, t) + sigma^2 / (2 a^2) (1 - e^{-a t})^2, so that expected pathwise discount
+     * factors reproduce the initial curve. On each grid step f(0, t) is the continuously
+     * compounded forward over the step and the convexity term is taken at mid-step.
+     */
+    class HullWhite final : public ShortRateModel {
+    public:
+        /**
+         * @param a Mean reversion speed (non-zero).
+         * @param sigma Rate volatility.
+         * @param curve Initial curve to fit.
+         */
+        HullWhite(double a, double sigma, std::shared_ptr<const YieldCurve> curve)
+            : a_(a), sigma_(sigma), curve_(std::move(curve)) {
+        }
+
+        double initialState() const override {
+            return 0.0;
+        }
+
+        double evolve(double x, double dt, double z) const override {
+            double decay = std::exp(-a_ * dt);
+            double stdev = sigma_ * std::sqrt(-std::expm1(-2.0 * a_ * dt) / (2.0 * a_));
+            return x * decay + stdev * z;
+        }
+
+        double discount(const Date& ref, const Date& t, const DayCounter&) const override {
+            return curve_->discount(t) / curve_->discount(ref);  // fitted exactly
+        }
+
+        std::vector<double> shift(const std::vector<Date>& dates, const DayCounter& dc) const override {
+            std::vector<double> alpha;
+            if (dates.size() < 2) return alpha;
+
+            alpha.reserve(dates.size() - 1);
+            for (size_t i = 0; i + 1 < dates.size(); ++i) {
+                double t = dc.yearFraction(dates[0], dates[i]);
+                double dt = dc.yearFraction(dates[i], dates[i + 1]);
+                double forward = std::log(curve_->discount(dates[i]) / curve_->discount(dates[i + 1])) / dt;
+                double convexity = sigma_ / a_ * -std::expm1(-a_ * (t + 0.5 * dt));  // mid-step
+                alpha.push_back(forward + 0.5 * convexity * convexity);
+            }
+            return alpha;
+        }
+
+    private:
+        double a_;
+        double sigma_;
+        std::shared_ptr<const YieldCurve> curve_;
+    };
+
+}
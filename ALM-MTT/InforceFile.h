@@ -0,0 +1,297 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <span>
+#include <memory>
+#include <fstream>
+#include <stdexcept>
+#include "Date.h"
+#include "CashFlow.h"
+#include "Asset.h"
+#include "Portfolio.h"
+#include "YieldCurve.h"
+#include "MappedFile.h"
+
+namespace ALM {
+
+    /**
+     * @brief Fixed 64-byte header of a binary inforce file.
+     *
+     * A file holds one portfolio (assets or liabilities) as four columns, each starting at an
+     * 8-byte aligned offset from the start of the file:
+     * - offsets: uint64_t[asset_count + 1], index of each asset's first cash flow
+     * - volumes: double[asset_count]
+     * - serials: int32_t[cash_flow_count], Date serials
+     * - amounts: double[cash_flow_count], unscaled amounts
+     *
+     * Values are in native byte order; byte_order records 0x01020304 as written by the producer.
+     */
+    struct InforceHeader {
+        char magic[8];              ///< "ALMINF\0\0"
+        uint32_t version;           ///< Format version, see InforceFile::Version
+        uint32_t byte_order;        ///< 0x01020304 in the writer's byte order
+        uint64_t asset_count;
+        uint64_t cash_flow_count;
+        uint64_t offsets_offset;    ///< Byte offset of the offsets column
+        uint64_t volumes_offset;    ///< Byte offset of the volumes column
+        uint64_t serials_offset;    ///< Byte offset of the serials column
+        uint64_t amounts_offset;    ///< Byte offset of the amounts column
+    };
+
+    static_assert(sizeof(InforceHeader) == 64, "InforceHeader layout is part of the file format");
+
+    /**
+     * @brief Memory-mapped, read-only view of a binary inforce file.
+     *
+     * Opening maps the file and validates the header and offsets column; cash flows are never
+     * parsed or copied. marketValue and cashFlow read the mapped columns directly and match the
+     * Portfolio methods of the same name, so a liability file can be passed straight to
+     * ProjectionKernel. Assets that a strategy will trade are materialized with toPortfolio().
+     */
+    class InforceFile {
+    public:
+        static constexpr uint32_t Version = 1;
+        static constexpr char Magic[8] = { 'A', 'L', 'M', 'I', 'N', 'F', '\0', '\0' };
+        static constexpr uint32_t ByteOrder = 0x01020304;
+
+        /**
+         * @brief Map and validate an inforce file.
+         * @throws std::runtime_error if the file is missing, truncated, or not a supported version.
+         */
+        explicit InforceFile(const std::string& path)
+            : file_(path) {
+            if (file_.size() < sizeof(InforceHeader))
+                throw std::runtime_error("InforceFile: truncated header in " + path);
+
+            std::memcpy(&header_, file_.data(), sizeof(InforceHeader));
+
+            if (std::memcmp(header_.magic, Magic, sizeof(Magic)) != 0)
+                throw std::runtime_error("InforceFile: not an inforce file " + path);
+            if (header_.version != Version)
+                throw std::runtime_error("InforceFile: unsupported version " + std::to_string(header_.version) + " in " + path);
+            if (header_.byte_order != ByteOrder)
+                throw std::runtime_error("InforceFile: byte order mismatch in " + path);
+
+            // Rejected before n + 1 is formed, so a corrupt count cannot wrap past the bounds check
+            if (header_.asset_count >= file_.size() / sizeof(uint64_t))
+                throw std::runtime_error("InforceFile: asset count out of bounds in " + path);
+
+            offsets_ = column<uint64_t>(header_.offsets_offset, header_.asset_count + 1, path);
+            volumes_ = column<double>(header_.volumes_offset, header_.asset_count, path);
+            serials_ = column<int32_t>(header_.serials_offset, header_.cash_flow_count, path);
+            amounts_ = column<double>(header_.amounts_offset, header_.cash_flow_count, path);
+
+            size_t n = volumes_.size();
+            size_t m = serials_.size();
+
+            // Guarantees every asset's cash flow range is in bounds for the valuation loops
+            if (offsets_[0] != 0 || offsets_[n] != m)
+                throw std::runtime_error("InforceFile: inconsistent offsets in " + path);
+            for (size_t i = 0; i < n; ++i) {
+                if (offsets_[i] > offsets_[i + 1])
+                    throw std::runtime_error("InforceFile: inconsistent offsets in " + path);
+            }
+        }
+
+        /// Number of assets
+        size_t size() const { return volumes_.size(); }
+
+        /// Total number of cash flows across all assets
+        size_t cashFlowCount() const { return serials_.size(); }
+
+        double volume(size_t i) const { return volumes_[i]; }
+
+        std::span<const uint64_t> offsets() const { return offsets_; }
+        std::span<const double> volumes() const { return volumes_; }
+        std::span<const int32_t> serials() const { return serials_; }
+        std::span<const double> amounts() const { return amounts_; }
+
+        /**
+         * @brief Market value of all assets as of a reference date; see Portfolio::marketValue.
+         */
+        double marketValue(const std::shared_ptr<const YieldCurve>& curve, const Date& ref) const {
+            return marketValue(*curve, ref);
+        }
+
+        template <YieldCurveType Curve>
+        double marketValue(const Curve& curve, const Date& ref) const {
+            double total = 0.0;
+
+            for (size_t i = 0; i < size(); ++i) {
+                double pv = 0.0;
+                for (uint64_t k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+                    if (serials_[k] >= ref.serial()) {
+                        pv += amounts_[k] * curve.discount(Date(serials_[k]));
+                    }
+                }
+                total += pv * volumes_[i];
+            }
+
+            return total / curve.discount(ref);
+        }
+
+        /**
+         * @brief Total cash flow over (from, to]; see Portfolio::cashFlow.
+         */
+        double cashFlow(const Date& from, const Date& to) const {
+            double total = 0.0;
+
+            for (size_t i = 0; i < size(); ++i) {
+                double cf = 0.0;
+                for (uint64_t k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+                    if (serials_[k] > from.serial() && serials_[k] <= to.serial()) {
+                        cf += amounts_[k];
+                    }
+                }
+                total += cf * volumes_[i];
+            }
+
+            return total;
+        }
+
+        /// Copy the i-th asset out of the mapping
+        Asset asset(size_t i) const {
+            std::vector<CashFlow> cash_flows;
+            cash_flows.reserve(static_cast<size_t>(offsets_[i + 1] - offsets_[i]));
+            for (uint64_t k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+                cash_flows.push_back({ Date(serials_[k]), amounts_[k] });
+            }
+            return Asset(std::move(cash_flows), volumes_[i]);
+        }
+
+        /// Materialize a mutable Portfolio, e.g. for the asset side of a projection
+        Portfolio toPortfolio() const {
+            std::vector<Asset> assets;
+            assets.reserve(size());
+            for (size_t i = 0; i < size(); ++i) {
+                assets.push_back(asset(i));
+            }
+            return Portfolio(std::move(assets));
+        }
+
+    private:
+        MappedFile file_;
+        InforceHeader header_;
+        std::span<const uint64_t> offsets_;
+        std::span<const double> volumes_;
+        std::span<const int32_t> serials_;
+        std::span<const double> amounts_;
+
+        template <typename T>
+        std::span<const T> column(uint64_t offset, uint64_t count, const std::string& path) const {
+            if (offset % alignof(T) != 0 || offset > file_.size()
+                || count > (file_.size() - offset) / sizeof(T))
+                throw std::runtime_error("InforceFile: column out of bounds in " + path);
+
+            return { reinterpret_cast<const T*>(file_.data() + offset), static_cast<size_t>(count) };
+        }
+    };
+
+    /**
+     * @brief Writes portfolios in the binary inforce format read by InforceFile.
+     */
+    class InforceWriter {
+    public:
+        /**
+         * @brief Write a portfolio, including any pending portfolio-wide scale in the volumes.
+         * @throws std::runtime_error if the file cannot be written.
+         */
+        static void write(const std::string& path, const Portfolio& portfolio) {
+            uint64_t n = portfolio.size();
+            uint64_t m = 0;
+            for (size_t i = 0; i < portfolio.size(); ++i) {
+                m += portfolio.asset(i).cashFlows().size();
+            }
+
+            InforceHeader header{};
+            std::memcpy(header.magic, InforceFile::Magic, sizeof(header.magic));
+            header.version = InforceFile::Version;
+            header.byte_order = InforceFile::ByteOrder;
+            header.asset_count = n;
+            header.cash_flow_count = m;
+            header.offsets_offset = sizeof(InforceHeader);
+            header.volumes_offset = align(header.offsets_offset + (n + 1) * sizeof(uint64_t));
+            header.serials_offset = align(header.volumes_offset + n * sizeof(double));
+            header.amounts_offset = align(header.serials_offset + m * sizeof(int32_t));
+
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            if (!out)
+                throw std::runtime_error("InforceWriter: cannot open " + path);
+
+            write(out, header);
+
+            uint64_t offset = 0;
+            write(out, offset);
+            for (size_t i = 0; i < portfolio.size(); ++i) {
+                offset += portfolio.asset(i).cashFlows().size();
+                write(out, offset);
+            }
+
+            pad(out, header.volumes_offset);
+            for (size_t i = 0; i < portfolio.size(); ++i) {
+                write(out, portfolio.volume(i));
+            }
+
+            pad(out, header.serials_offset);
+            for (size_t i = 0; i < portfolio.size(); ++i) {
+                for (const auto& cf : portfolio.asset(i).cashFlows()) {
+                    write(out, static_cast<int32_t>(cf.date.serial()));
+                }
+            }
+
+            pad(out, header.amounts_offset);
+            for (size_t i = 0; i < portfolio.size(); ++i) {
+                for (const auto& cf : portfolio.asset(i).cashFlows()) {
+                    write(out, cf.amount);
+                }
+            }
+
+            if (!out)
+                throw std::runtime_error("InforceWriter: write failed for " + path);
+        }
+
+    private:
+        static uint64_t align(uint64_t offset) {
+            return (offset + 7) & ~uint64_t(7);
+        }
+
+        template <typename T>
+        static void write(std::ofstream& out, const T& value) {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        static void pad(std::ofstream& out, uint64_t offset) {
+            while (static_cast<uint64_t>(out.tellp()) < offset) {
+                out.put('\0');
+            }
+        }
+    };
+
+}
@@ -0,0 +1,324 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#include "Date.h"
+#include "DayCounter.h"
+#include "YieldCurve.h"
+
+namespace ALM {
+
+    /**
+     * @brief Piecewise yield curve interpolated in log discount factor, with a dense lookup grid.
+     *
+     * Discount factors are interpolated between pillars either linearly in log discount (piecewise
+     * flat forwards) or with a monotone (Fritsch-Carlson) cubic, which keeps forwards positive for
+     * decreasing discount factors. At construction the curve is evaluated on a uniform grid of
+     * `grid_days` spacing from the reference date to the last pillar, so discount() inside that
+     * range is one indexed load (daily grid) or a load plus a linear interpolation (coarser grid),
+     * with no day counting, search or exponentials. Dates outside the grid use the interpolator
+     * directly, extrapolating the last forward rate beyond the last pillar.
+     *
+     * The daily grid reproduces the interpolator exactly. A coarser grid uses less memory but its
+     * lerp smooths over the forward-rate jumps at pillars; for log-linear curves with typical
+     * pillar spacing and a 30-day grid the discount factor error is of order 1e-4 near pillars.
+     *
+     * The node year fractions and the grid's dates, year fractions and segments depend only on the
+     * reference date, pillar dates, day counter and spacing. They live in a shared Layout, so
+     * curves built in bulk on the same pillars (e.g. by ParCurveBootstrapper) pay for day counting
+     * once and only evaluate the interpolant and an exponential per grid point.
+     */
+    class InterpolatedCurve final : public YieldCurve {
+    public:
+        enum class Interpolation {
+            LogLinear,       ///< Linear in log discount factor
+            MonotoneCubic    ///< Fritsch-Carlson monotone cubic in log discount factor
+        };
+
+        /**
+         * @brief Pillar and grid geometry shared by curves on the same dates.
+         */
+        class Layout {
+        public:
+            /**
+             * @param ref Reference date (discount factor 1).
+             * @param dates Strictly increasing pillar dates after ref.
+             * @param dc Day counter for year fractions.
+             * @param grid_days Lookup grid spacing in days (1 = daily, 30 ~ monthly).
+             */
+            Layout(const Date& ref, const std::vector<Date>& dates, DayCounter dc, int grid_days = 1)
+                : ref_(ref), dc_(dc), grid_days_(grid_days) {
+                if (dates.empty())
+                    throw std::invalid_argument("InterpolatedCurve: at least one pillar date is required");
+                if (grid_days < 1)
+                    throw std::invalid_argument("InterpolatedCurve: grid spacing must be at least one day");
+
+                x_.push_back(0.0);
+                Date prev = ref;
+                for (const auto& date : dates) {
+                    if (date <= prev)
+                        throw std::invalid_argument("InterpolatedCurve: pillar dates must be increasing");
+                    x_.push_back(dc_.yearFraction(ref_, date));
+                    prev = date;
+                }
+
+                // Grid dates are increasing, so walk the segments rather than searching for each point
+                int points = (dates.back() - ref_) / grid_days_ + 2;  // one node past the last pillar for the final lerp
+                grid_t_.resize(points);
+                grid_segment_.resize(points);
+                size_t k = 0;
+                size_t last_segment = x_.size() - 2;
+                for (int i = 0; i < points; ++i) {
+                    double x = dc_.yearFraction(ref_, ref_ + Duration(i * grid_days_, Duration::Unit::Days));
+                    while (k < last_segment && x >= x_[k + 1]) ++k;
+                    grid_t_[i] = (x - x_[k]) / (x_[k + 1] - x_[k]);
+                    grid_segment_[i] = static_cast<uint32_t>(k);
+                }
+                grid_end_ = (points - 1) * grid_days_;
+            }
+
+            const Date& reference() const { return ref_; }
+            const DayCounter& dayCounter() const { return dc_; }
+            size_t size() const { return x_.size() - 1; }  ///< Number of pillars
+
+        private:
+            friend class InterpolatedCurve;
+
+            Date ref_;
+            DayCounter dc_;
+            int grid_days_;
+            int grid_end_ = 0;                   // days covered by the lookup grid: [0, grid_end_)
+            std::vector<double> x_;              // node year fractions, x_[0] = 0
+            std::vector<double> grid_t_;         // position of each grid point within its segment
+            std::vector<uint32_t> grid_segment_; // node segment containing each grid point; the last
+                                                 // segment extends past the last pillar (t > 1)
+        };
+
+        /**
+         * @brief Construct from pillar discount factors.
+         *
+         * @param ref Reference date (discount factor 1).
+         * @param dates Strictly increasing pillar dates after ref.
+         * @param discounts Discount factor at each pillar.
+         * @param dc Day counter for year fractions.
+         * @param interpolation Interpolation scheme between pillars.
+         * @param grid_days Lookup grid spacing in days (1 = daily, 30 ~ monthly).
+         */
+        InterpolatedCurve(
+            const Date& ref,
+            const std::vector<Date>& dates,
+            const std::vector<double>& discounts,
+            DayCounter dc,
+            Interpolation interpolation = Interpolation::LogLinear,
+            int grid_days = 1)
+            : InterpolatedCurve(std::make_shared<const Layout>(ref, dates, dc, grid_days), discounts, interpolation) {
+        }
+
+        /**
+         * @brief Construct on a shared layout.
+         *
+         * @param layout Pillar and grid geometry, e.g. shared by all scenarios of a bootstrap.
+         * @param discounts Discount factor at each pillar of the layout.
+         * @param interpolation Interpolation scheme between pillars.
+         */
+        InterpolatedCurve(
+            std::shared_ptr<const Layout> layout,
+            const std::vector<double>& discounts,
+            Interpolation interpolation = Interpolation::LogLinear)
+            : layout_(std::move(layout)) {
+            if (discounts.size() != layout_->size())
+                throw std::invalid_argument("InterpolatedCurve: need one discount factor per pillar date");
+
+            y_.reserve(discounts.size() + 1);
+            y_.push_back(0.0);
+            for (double discount : discounts) {
+                if (discount <= 0.0)
+                    throw std::invalid_argument("InterpolatedCurve: discount factors must be positive");
+                y_.push_back(std::log(discount));
+            }
+
+            if (interpolation == Interpolation::MonotoneCubic)
+                computeTangents();
+
+            buildGrid();
+        }
+
+        /**
+         * @brief Construct from annually compounded zero rates at the pillars.
+         */
+        static InterpolatedCurve fromZeroRates(
+            const Date& ref,
+            const std::vector<Date>& dates,
+            const std::vector<double>& zero_rates,
+            DayCounter dc,
+            Interpolation interpolation = Interpolation::LogLinear,
+            int grid_days = 1) {
+            std::vector<double> discounts;
+            discounts.reserve(dates.size());
+            for (size_t i = 0; i < dates.size() && i < zero_rates.size(); ++i) {
+                discounts.push_back(std::pow(1.0 + zero_rates[i], -dc.yearFraction(ref, dates[i])));
+            }
+            return InterpolatedCurve(ref, dates, discounts, dc, interpolation, grid_days);
+        }
+
+        double discount(const Date& t) const override {
+            int days = t - layout_->ref_;
+            if (days >= 0 && days < layout_->grid_end_) {
+                int grid_days = layout_->grid_days_;
+                if (grid_days == 1)
+                    return grid_[days];
+
+                int i = days / grid_days;
+                double w = static_cast<double>(days - i * grid_days) / grid_days;
+                return grid_[i] + w * (grid_[i + 1] - grid_[i]);
+            }
+            return std::exp(logDiscount(yearFraction(t)));
+        }
+
+        double zero(const Date& t) const override {
+            double yf = yearFraction(t);
+            if (yf <= 0.0) return forwardAt(0.0);
+            return std::exp(-std::log(discount(t)) / yf) - 1.0;
+        }
+
+        double forward(const Date& t1, const Date& t2) const override {
+            double yf1 = yearFraction(t1);
+            double yf2 = yearFraction(t2);
+            if (yf2 <= yf1) return forwardAt(yf1);
+            return std::pow(discount(t1) / discount(t2), 1.0 / (yf2 - yf1)) - 1.0;
+        }
+
+        Date reference() const override {
+            return layout_->ref_;
+        }
+
+        /// Shared pillar and grid geometry
+        const std::shared_ptr<const Layout>& layout() const {
+            return layout_;
+        }
+
+    private:
+        std::shared_ptr<const Layout> layout_;
+        std::vector<double> y_;     // node log discount factors, y_[0] = 0
+        std::vector<double> m_;     // cubic tangents dy/dx; empty for log-linear
+        std::vector<double> grid_;  // discount factors every grid_days days from the reference
+
+        double yearFraction(const Date& t) const {
+            return layout_->dc_.yearFraction(layout_->ref_, t);
+        }
+
+        // Fritsch-Carlson tangents for a monotone cubic Hermite interpolant
+        void computeTangents() {
+            const auto& x_ = layout_->x_;
+            size_t n = x_.size();
+            std::vector<double> d(n - 1);
+            for (size_t k = 0; k + 1 < n; ++k) {
+                d[k] = (y_[k + 1] - y_[k]) / (x_[k + 1] - x_[k]);
+            }
+
+            m_.assign(n, 0.0);
+            m_[0] = d[0];
+            m_[n - 1] = d[n - 2];
+            for (size_t k = 1; k + 1 < n; ++k) {
+                m_[k] = (d[k - 1] * d[k] > 0.0) ? 0.5 * (d[k - 1] + d[k]) : 0.0;
+            }
+
+            for (size_t k = 0; k + 1 < n; ++k) {
+                if (d[k] == 0.0) {
+                    m_[k] = m_[k + 1] = 0.0;
+                    continue;
+                }
+                double a = m_[k] / d[k];
+                double b = m_[k + 1] / d[k];
+                double r = a * a + b * b;
+                if (r > 9.0) {
+                    double tau = 3.0 / std::sqrt(r);
+                    m_[k] = tau * a * d[k];
+                    m_[k + 1] = tau * b * d[k];
+                }
+            }
+        }
+
+        // Log discount factor at a year fraction from the reference date
+        double logDiscount(double x) const {
+            const auto& x_ = layout_->x_;
+            size_t n = x_.size();
+            if (x <= 0.0)
+                return forwardSlope(0) * x;
+            if (x >= x_[n - 1])
+                return y_[n - 1] + forwardSlope(n - 2) * (x - x_[n - 1]);
+
+            size_t k = static_cast<size_t>(std::upper_bound(x_.begin(), x_.end(), x) - x_.begin()) - 1;
+            return interpolate(k, (x - x_[k]) / (x_[k + 1] - x_[k]));
+        }
+
+        // Log discount factor at relative position t in [0, 1] of segment [x_[k], x_[k + 1]]
+        double interpolate(size_t k, double t) const {
+            const auto& x_ = layout_->x_;
+            double h = x_[k + 1] - x_[k];
+
+            if (m_.empty())
+                return y_[k] + t * (y_[k + 1] - y_[k]);
+
+            double t2 = t * t, t3 = t2 * t;
+            return (2 * t3 - 3 * t2 + 1) * y_[k] + (t3 - 2 * t2 + t) * h * m_[k]
+                + (-2 * t3 + 3 * t2) * y_[k + 1] + (t3 - t2) * h * m_[k + 1];
+        }
+
+        // d(log discount)/dx used for extrapolation: end tangent for cubic, segment slope otherwise
+        double forwardSlope(size_t segment) const {
+            const auto& x_ = layout_->x_;
+            if (!m_.empty())
+                return segment == 0 ? m_[0] : m_[segment + 1];
+            return (y_[segment + 1] - y_[segment]) / (x_[segment + 1] - x_[segment]);
+        }
+
+        // Annually compounded instantaneous forward rate at a year fraction
+        double forwardAt(double x) const {
+            double h = 1e-4;
+            return std::exp(-(logDiscount(x + h) - logDiscount(x)) / h) - 1.0;
+        }
+
+        void buildGrid() {
+            const auto& x_ = layout_->x_;
+            const auto& grid_t = layout_->grid_t_;
+            const auto& segment = layout_->grid_segment_;
+
+            grid_.resize(grid_t.size());
+            for (size_t i = 0; i < grid_t.size(); ++i) {
+                size_t k = segment[i];
+                double t = grid_t[i];
+                grid_[i] = std::exp(t <= 1.0 ? interpolate(k, t) : logDiscount(x_[k] + t * (x_[k + 1] - x_[k])));
+            }
+        }
+    };
+
+}
@@ -0,0 +1,359 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+/**
+ * Deferred logging. The level is checked before any argument is evaluated, so a disabled
+ * message costs one relaxed load; an enabled one copies its arguments into the thread's buffer
+ * and formatting happens on the background flusher. The format must be a string literal with
+ * "{}" placeholders ("{{" and "}}" for braces), e.g. ALM_LOG_DEBUG("Iter {}, fx = {}", iter, fx).
+ */
+#define ALM_LOG(level, ...) do { if (::ALM::Log::enabled(level)) ::ALM::Log::record(level, __VA_ARGS__); } while (0)
+#define ALM_LOG_ERROR(...) ALM_LOG(::ALM::Log::Level::Error, __VA_ARGS__)
+#define ALM_LOG_WARN(...) ALM_LOG(::ALM::Log::Level::Warn, __VA_ARGS__)
+#define ALM_LOG_INFO(...) ALM_LOG(::ALM::Log::Level::Info, __VA_ARGS__)
+#define ALM_LOG_DEBUG(...) ALM_LOG(::ALM::Log::Level::Debug, __VA_ARGS__)
+
+namespace ALM {
+
+    /**
+     * @brief Asynchronous logger with lock-free per-thread buffers.
+     *
+     * Each thread appends records to its own single-producer ring; a background thread drains
+     * all rings every flush interval, orders records by time and writes whole lines, so output
+     * from parallel tasks never interleaves and a logging task never waits on the console.
+     * A full ring drops the record and counts it rather than blocking. Synchronous writers
+     * (UI) take lockOutput(), which first writes everything already recorded.
+     */
+    class Log {
+    public:
+        /// Mirrors UI::Verbosity
+        enum class Level {
+            Silent = 0,
+            Error = 1,
+            Warn = 2,
+            Info = 3,
+            Debug = 4
+        };
+
+        static constexpr size_t MaxArgs = 8;
+        static constexpr size_t DefaultCapacity = 1024;
+
+        static bool enabled(Level level) {
+            return level != Level::Silent && static_cast<int>(level) <= level_.load(std::memory_order_relaxed);
+        }
+
+        static void setLevel(Level level) {
+            level_.store(static_cast<int>(level), std::memory_order_relaxed);
+        }
+
+        static Level level() {
+            return static_cast<Level>(level_.load(std::memory_order_relaxed));
+        }
+
+        static void useColor(bool use_color = true) {
+            use_color_.store(use_color, std::memory_order_relaxed);
+        }
+
+        /// Destination of formatted lines, std::cout by default
+        static void setOutput(std::ostream& out) {
+            auto lock = lockOutput();
+            state().out = &out;
+        }
+
+        /// Records kept per thread between flushes; applies to threads that have not logged yet
+        static void setCapacity(size_t records) {
+            std::lock_guard lock(state().registry_mutex);
+            state().capacity = std::max<size_t>(records, 1);
+        }
+
+        static void setFlushInterval(std::chrono::milliseconds interval) {
+            std::lock_guard lock(state().registry_mutex);
+            state().interval = interval;
+        }
+
+        /// Records discarded because a thread's buffer was full
+        static size_t dropped() {
+            return state().dropped.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Queues a record; use through the ALM_LOG_* macros so the level is checked first.
+         */
+        template <typename... Args>
+        static void record(Level level, const char* format, const Args&... args) {
+            static_assert(sizeof...(Args) <= MaxArgs, "Log::record: too many arguments");
+
+            Buffer& buffer = local();
+            Record* slot = buffer.claim();
+            if (!slot) {
+                state().dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            slot->time = std::chrono::steady_clock::now();
+            slot->level = level;
+            slot->format = format;
+            slot->count = sizeof...(Args);
+            size_t i = 0;
+            ((slot->args[i++] = toArg(args)), ...);
+            buffer.publish();
+        }
+
+        /// Writes everything recorded so far on the calling thread
+        static void flush() {
+            lockOutput();
+        }
+
+        /**
+         * @brief Flushes pending records and returns a lock on the output for synchronous writes.
+         */
+        static std::unique_lock<std::mutex> lockOutput() {
+            std::unique_lock lock(state().output_mutex);
+            drain();
+            return lock;
+        }
+
+    private:
+        using Arg = std::variant<std::monostate, long long, unsigned long long, double, bool, char, std::string>;
+
+        struct Record {
+            std::chrono::steady_clock::time_point time;
+            Level level = Level::Info;
+            const char* format = "";
+            size_t count = 0;
+            std::array<Arg, MaxArgs> args;
+        };
+
+        // Single-producer (the owning thread), single-consumer (the flusher) ring
+        struct Buffer {
+            explicit Buffer(size_t capacity)
+                : slots(capacity) {
+            }
+
+            Record* claim() {
+                uint64_t tail = tail_.load(std::memory_order_relaxed);
+                if (tail - head_.load(std::memory_order_acquire) == slots.size()) return nullptr;
+                return &slots[tail % slots.size()];
+            }
+
+            void publish() {
+                tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+
+            void take(std::vector<Record>& out) {
+                uint64_t head = head_.load(std::memory_order_relaxed);
+                uint64_t tail = tail_.load(std::memory_order_acquire);
+                for (uint64_t i = head; i < tail; ++i) {
+                    out.push_back(std::move(slots[i % slots.size()]));
+                }
+                head_.store(tail, std::memory_order_release);
+            }
+
+            std::vector<Record> slots;
+            std::atomic<uint64_t> head_{ 0 };
+            std::atomic<uint64_t> tail_{ 0 };
+            std::atomic<bool> retired{ false };   // owning thread has exited
+        };
+
+        // Retires the thread's buffer on thread exit so the flusher can free it once drained
+        struct Owner {
+            Buffer* buffer = nullptr;
+
+            ~Owner() {
+                if (buffer) buffer->retired.store(true, std::memory_order_release);
+            }
+        };
+
+        struct State {
+            std::mutex registry_mutex;
+            std::vector<std::unique_ptr<Buffer>> buffers;
+            size_t capacity = DefaultCapacity;
+            std::chrono::milliseconds interval{ 50 };
+
+            std::mutex output_mutex;        // held while draining and by synchronous writers
+            std::ostream* out = &std::cout;
+            std::atomic<size_t> dropped{ 0 };
+
+            std::thread flusher;
+            std::condition_variable wake;
+            bool stopping = false;
+
+            ~State() {
+                if (flusher.joinable()) {
+                    {
+                        std::lock_guard lock(registry_mutex);
+                        stopping = true;
+                    }
+                    wake.notify_all();
+                    flusher.join();
+                }
+                std::lock_guard lock(output_mutex);
+                drain();
+            }
+        };
+
+        static inline std::atomic<int> level_{ static_cast<int>(Level::Info) };
+        static inline std::atomic<bool> use_color_{ false };
+
+        static State& state() {
+            static State instance;
+            return instance;
+        }
+
+        // The calling thread's buffer; the first one registered starts the flusher
+        static Buffer& local() {
+            thread_local Owner owner;
+            if (!owner.buffer) {
+                State& s = state();
+                std::lock_guard lock(s.registry_mutex);
+                s.buffers.push_back(std::make_unique<Buffer>(s.capacity));
+                owner.buffer = s.buffers.back().get();
+                if (!s.flusher.joinable()) {
+                    s.flusher = std::thread(flushLoop);
+                }
+            }
+            return *owner.buffer;
+        }
+
+        static void flushLoop() {
+            State& s = state();
+            std::unique_lock lock(s.registry_mutex);
+            while (!s.stopping) {
+                s.wake.wait_for(lock, s.interval, [&s]() { return s.stopping; });
+                lock.unlock();
+                {
+                    std::lock_guard output(s.output_mutex);
+                    drain();
+                }
+                lock.lock();
+            }
+        }
+
+        // Writes all published records in time order and frees the buffers of exited threads;
+        // caller holds output_mutex
+        static void drain() {
+            State& s = state();
+            std::vector<Record> records;
+            {
+                std::lock_guard lock(s.registry_mutex);
+                std::erase_if(s.buffers, [&records](const std::unique_ptr<Buffer>& buffer) {
+                    // Checked before taking: a retired buffer receives no further records
+                    bool retired = buffer->retired.load(std::memory_order_acquire);
+                    buffer->take(records);
+                    return retired;
+                });
+            }
+            if (records.empty()) return;
+
+            std::stable_sort(records.begin(), records.end(),
+                [](const Record& a, const Record& b) { return a.time < b.time; });
+
+            std::ostringstream text;
+            bool color = use_color_.load(std::memory_order_relaxed);
+            for (const Record& record : records) {
+                writeLine(text, record, color);
+            }
+            *s.out << text.str();
+            s.out->flush();
+        }
+
+        static void writeLine(std::ostream& out, const Record& record, bool color) {
+            const char* prefix = "";
+            const char* shade = "";
+            switch (record.level) {
+            case Level::Error: prefix = "[ERROR] "; shade = "\033[31m"; break;
+            case Level::Warn: prefix = "[WARNING] "; shade = "\033[33m"; break;
+            case Level::Debug: prefix = "[DEBUG] "; shade = "\033[2;37m"; break;
+            default: break;
+            }
+
+            if (color) out << shade;
+            out << prefix;
+
+            std::string_view format(record.format);
+            size_t next = 0;
+            for (size_t i = 0; i < format.size(); ++i) {
+                char c = format[i];
+                if ((c == '{' || c == '}') && i + 1 < format.size() && format[i + 1] == c) {
+                    out << c;
+                    ++i;
+                }
+                else if (c == '{' && i + 1 < format.size() && format[i + 1] == '}') {
+                    if (next < record.count) {
+                        std::visit([&out](const auto& value) { writeArg(out, value); }, record.args[next++]);
+                    }
+                    ++i;
+                }
+                else {
+                    out << c;
+                }
+            }
+
+            if (color && *shade) out << "\033[0m";
+            out << "\n";
+        }
+
+        static void writeArg(std::ostream&, std::monostate) {}
+        static void writeArg(std::ostream& out, bool value) { out << (value ? "true" : "false"); }
+        template <typename T>
+        static void writeArg(std::ostream& out, const T& value) { out << value; }
+
+        template <typename T>
+        static Arg toArg(const T& value) {
+            if constexpr (std::is_same_v<T, bool>) return value;
+            else if constexpr (std::is_same_v<T, char>) return value;
+            else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) return static_cast<long long>(value);
+            else if constexpr (std::is_integral_v<T>) return static_cast<unsigned long long>(value);
+            else if constexpr (std::is_floating_point_v<T>) return static_cast<double>(value);
+            else if constexpr (std::is_convertible_v<const T&, std::string_view>) return std::string(std::string_view(value));
+            else {
+                // Anything else streamable is rendered now, since it may not outlive the record
+                std::ostringstream text;
+                text << value;
+                return text.str();
+            }
+        }
+    };
+
+}
@@ -124,14 +124,8 @@ int main() {
             Duration(1, Duration::Unit::Years)
         );
 
-        auto results = runner.run();
-
-        double tmp = 0;
-        for (const auto& result : results) {
-            tmp = std::max(tmp, result.assets_bop[0]);
-        }
-
-        return tmp;
+        // The same as the maximum over run(), so finite differences see no solver noise
+        return runner.runMax().maximum;
 
         };
 
@@ -157,6 +151,14 @@ int main() {
     std::cout << "Asset Scalars:\t\t[" << std::setprecision(2) << std::fixed << result.x.transpose() << "]" << std::endl;
     std::cout << "\n";
 
+    if constexpr (Trace::enabled()) {
+        UI::section("Trace");
+        std::ofstream trace("alm-trace.json");
+        Trace::writeChromeJson(trace);
+        Trace::writeSummary(std::cout);
+        UI::print("Trace events written to alm-trace.json");
+    }
+
     return 0;
 
 }
\ No newline at end of file
@@ -0,0 +1,256 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include "ProjectionKernel.h"
+#include "SobolSequence.h"
+
+namespace ALM {
+
+    /**
+     * @brief Mean estimate from a scenario set, with its error and variance reduction.
+     */
+    struct MonteCarloEstimate {
+        double mean = 0.0;
+        double standard_error = 0.0;
+        double variance_reduction = 1.0;  ///< Plain Monte Carlo variance of the mean for the same scenario count, divided by this estimator's variance
+        size_t scenarios = 0;
+        size_t samples = 0;               ///< Independent samples the error is estimated from
+        double control_beta = 0.0;        ///< Control-variate coefficient; 0 without a control
+
+        /// Plain Monte Carlo scenarios needed for the same standard error
+        double equivalentScenarios() const {
+            return variance_reduction * static_cast<double>(scenarios);
+        }
+    };
+
+    /**
+     * @brief Reduces per-scenario values to a mean with a standard error, optionally using a
+     *        control variate.
+     *
+     * Scenarios are taken in consecutive groups of `group_size` that are independent of each
+     * other but may be correlated within (antithetic pairs, or the points of one randomised
+     * quasi-Monte Carlo replicate); see ShortRateScenarioGenerator::groupSize. The error is
+     * estimated from the spread of group means.
+     *
+     * With a control (a per-scenario quantity with known mean, such as the liability PV on the
+     * scenario curve against its analytic PV), each group mean y is replaced by
+     * y - beta (c - E[c]) with beta = Cov(y, c) / Var(c) fitted on the groups.
+     *
+     * The variance reduction compares the estimator's variance with that of a plain Monte Carlo
+     * mean over the same number of scenarios, using the raw scenario variance, so it is the
+     * factor by which the scenario count could shrink for the same confidence interval.
+     */
+    class MonteCarloEstimator {
+    public:
+        static MonteCarloEstimate estimate(const std::vector<double>& values, size_t group_size = 1) {
+            return estimate(values, {}, 0.0, group_size);
+        }
+
+        /**
+         * @param values Per-scenario values.
+         * @param controls Per-scenario control values, or empty for none.
+         * @param control_mean Known expectation of the control.
+         * @param group_size Consecutive scenarios forming one independent sample.
+         */
+        static MonteCarloEstimate estimate(
+            const std::vector<double>& values,
+            const std::vector<double>& controls,
+            double control_mean,
+            size_t group_size = 1) {
+            size_t n = values.size();
+            if (!controls.empty() && controls.size() != n)
+                throw std::invalid_argument("MonteCarloEstimator: need one control value per scenario");
+            if (group_size == 0 || n % group_size != 0 || n / group_size < 2)
+                throw std::invalid_argument("MonteCarloEstimator: need at least two complete independent groups");
+
+            size_t groups = n / group_size;
+            std::vector<double> y(groups, 0.0), c(groups, 0.0);
+            for (size_t i = 0; i < n; ++i) {
+                y[i / group_size] += values[i] / group_size;
+                if (!controls.empty()) c[i / group_size] += controls[i] / group_size;
+            }
+
+            MonteCarloEstimate result;
+            result.scenarios = n;
+            result.samples = groups;
+
+            if (!controls.empty()) {
+                double y_mean = average(y), c_mean = average(c);
+                double cov = 0.0, var = 0.0;
+                for (size_t j = 0; j < groups; ++j) {
+                    cov += (y[j] - y_mean) * (c[j] - c_mean);
+                    var += (c[j] - c_mean) * (c[j] - c_mean);
+                }
+                result.control_beta = var > 0.0 ? cov / var : 0.0;
+                for (size_t j = 0; j < groups; ++j) {
+                    y[j] -= result.control_beta * (c[j] - control_mean);
+                }
+            }
+
+            result.mean = average(y);
+            double estimator_variance = variance(y) / groups;
+            result.standard_error = std::sqrt(estimator_variance);
+
+            double plain_variance = variance(values) / n;
+            result.variance_reduction = estimator_variance > 0.0
+                ? plain_variance / estimator_variance
+                : std::numeric_limits<double>::infinity();
+
+            return result;
+        }
+
+        /**
+         * @brief Required starting assets across projected scenarios.
+         *
+         * Uses each scenario's starting asset value, with its starting liability PV as the
+         * control when the analytic liability PV is given (e.g. the liabilities valued on
+         * ShortRateScenarioGenerator::expectedCurve).
+         */
+        static MonteCarloEstimate startingAssets(
+            const std::vector<ProjectionResult>& results,
+            size_t group_size = 1,
+            std::optional<double> liability_pv_mean = std::nullopt) {
+            std::vector<double> values, controls;
+            values.reserve(results.size());
+            for (const auto& result : results) {
+                values.push_back(result.assets_bop.empty() ? 0.0 : result.assets_bop.front());
+                if (liability_pv_mean)
+                    controls.push_back(result.liabilities_bop.empty() ? 0.0 : result.liabilities_bop.front());
+            }
+            return estimate(values, controls, liability_pv_mean.value_or(0.0), group_size);
+        }
+
+        /**
+         * @brief Conditional tail expectation: the mean of the worst (1 - level) share of values,
+         *        where higher is worse (e.g. required starting assets).
+         *
+         * The standard error is the asymptotic one of Manistre and Hancock,
+         * sqrt((V + level (CTE - VaR)^2) / m) over the m tail scenarios, with V the variance of
+         * the tail values and VaR the smallest of them. Scenarios are treated as independent.
+         */
+        static MonteCarloEstimate tailExpectation(const std::vector<double>& values, double level) {
+            if (level <= 0.0 || level >= 1.0)
+                throw std::invalid_argument("MonteCarloEstimator: tail level must be in (0, 1)");
+            size_t n = values.size();
+            size_t m = tailCount(n, level);
+            if (m < 2)
+                throw std::invalid_argument("MonteCarloEstimator: need at least two tail scenarios");
+
+            std::vector<double> tail(values);
+            std::nth_element(tail.begin(), tail.begin() + (n - m), tail.end());
+            tail.erase(tail.begin(), tail.begin() + (n - m));
+            double value_at_risk = *std::min_element(tail.begin(), tail.end());
+
+            MonteCarloEstimate result;
+            result.scenarios = n;
+            result.samples = n;
+            result.mean = average(tail);
+            double excess = result.mean - value_at_risk;
+            result.standard_error = std::sqrt((variance(tail) + level * excess * excess) / m);
+            return result;
+        }
+
+        /// Number of the n values tailExpectation averages at the given level
+        static size_t tailCount(size_t n, double level) {
+            return static_cast<size_t>(std::ceil((1.0 - level) * n - 1e-9));
+        }
+
+    private:
+        static double average(const std::vector<double>& x) {
+            double sum = 0.0;
+            for (double v : x) sum += v;
+            return sum / x.size();
+        }
+
+        static double variance(const std::vector<double>& x) {
+            double m = average(x), sum = 0.0;
+            for (double v : x) sum += (v - m) * (v - m);
+            return sum / (x.size() - 1);
+        }
+    };
+
+    /**
+     * @brief Stopping rule for a sequential Monte Carlo run: the statistic to estimate and the
+     *        confidence interval half-width at which it counts as converged.
+     *
+     * The run stops once the half-width is within the larger of the absolute tolerance and the
+     * relative tolerance times the estimate.
+     */
+    struct SequentialStopping {
+        enum class Statistic {
+            Mean,               ///< Scenario mean, with its error from independent groups
+            TailExpectation     ///< Conditional tail expectation at tail_level
+        };
+
+        Statistic statistic = Statistic::Mean;
+        double tail_level = 0.9;            ///< CTE level; 0.9 averages the worst 10% of scenarios
+        double relative_tolerance = 1e-3;
+        double absolute_tolerance = 0.0;
+        double confidence = 0.95;           ///< Two-sided confidence of the interval
+        size_t initial_scenarios = 64;      ///< Size of the first wave; raised to minimumScenarios()
+        size_t group_size = 1;              ///< See MonteCarloEstimator; waves stay whole groups
+
+        /**
+         * @brief Fewest scenarios the statistic can be estimated from: two groups for the mean,
+         *        two tail scenarios for the tail expectation.
+         */
+        size_t minimumScenarios() const {
+            if (statistic == Statistic::Mean)
+                return 2 * std::max<size_t>(group_size, 1);
+            if (tail_level <= 0.0 || tail_level >= 1.0)
+                throw std::invalid_argument("SequentialStopping: tail level must be in (0, 1)");
+            size_t n = static_cast<size_t>(1.0 / (1.0 - tail_level));
+            while (MonteCarloEstimator::tailCount(n, tail_level) < 2) ++n;
+            return n;
+        }
+
+        MonteCarloEstimate estimate(const std::vector<double>& values) const {
+            return statistic == Statistic::Mean
+                ? MonteCarloEstimator::estimate(values, group_size)
+                : MonteCarloEstimator::tailExpectation(values, tail_level);
+        }
+
+        double halfWidth(const MonteCarloEstimate& estimate) const {
+            return SobolSequence::inverseNormal(0.5 + 0.5 * confidence) * estimate.standard_error;
+        }
+
+        double tolerance(const MonteCarloEstimate& estimate) const {
+            return std::max(absolute_tolerance, relative_tolerance * std::abs(estimate.mean));
+        }
+
+        bool satisfied(const MonteCarloEstimate& estimate) const {
+            return halfWidth(estimate) <= tolerance(estimate);
+        }
+    };
+
+}
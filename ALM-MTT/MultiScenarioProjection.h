@@ -25,20 +25,63 @@
 #pragma once
 
 #include <vector>
+#include <algorithm>
 #include <memory>
 #include <iostream>
 #include <mutex>
+#include <thread>
+#include <functional>
+#include <exception>
+#include <atomic>
+#include <numeric>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
 
 #include "Date.h"
 #include "Portfolio.h"
 #include "Strategy.h"
 #include "TaskExecutor.h"
+#include "CancellationToken.h"
+#include "BoundedQueue.h"
 #include "Projection.h"
+#include "ProjectionKernel.h"
 #include "StartingAssetSolver.h"
+#include "MonteCarloEstimator.h"
 #include "YieldCurve.h"
+#include "ScenarioSet.h"
+#include "ResultFile.h"
+#include "Trace.h"
 
 namespace ALM {
 
+    /**
+     * @brief Outcome of an adaptive run: the scenarios projected and the estimate they support.
+     */
+    struct AdaptiveProjection {
+        std::vector<ProjectionResult> results;  ///< The first results.size() scenarios, in index order
+        MonteCarloEstimate estimate;
+        double half_width = 0.0;                ///< Confidence interval half-width of the estimate
+        size_t waves = 0;
+        bool converged = false;                 ///< False if the scenarios ran out or the run was cancelled
+    };
+
+    /**
+     * @brief Outcome of a max reduction: the largest required starting asset value across
+     *        scenarios, without solving scenarios that provably fall below it.
+     */
+    struct MaxReduction {
+        double maximum = 0.0;               ///< Largest starting asset value (assets_bop[0])
+        size_t scenario = 0;                ///< Scenario attaining the maximum
+        ProjectionResult result;            ///< That scenario's projection at its solved scale
+        std::vector<size_t> order;          ///< Order for the next run: solved scenarios worst first
+        size_t solved = 0;                  ///< Scenarios solved to convergence
+        size_t pruned = 0;                  ///< Scenarios shown to fall below the running maximum
+        size_t polished = 0;                ///< Scenarios near the maximum re-solved as run() solves them
+        bool complete = true;               ///< False if cancelled; the maximum is then a lower bound
+    };
+
     /**
      * @brief Runs a projection over multiple yield curve scenarios using a shared RelinkableHandle.
      *
@@ -47,6 +90,15 @@ namespace ALM {
      */
     class MultiScenarioProjection {
     public:
+        /// Produces the curve for a scenario index; called from a single producer thread
+        using ScenarioSource = std::function<std::shared_ptr<const YieldCurve>(size_t)>;
+
+        /// Per-scenario value an adaptive run estimates a statistic of
+        using Metric = std::function<double(const ProjectionResult&)>;
+
+        /// Receives each finished scenario's result with its index; called from worker threads
+        using ResultSink = std::function<void(size_t, ProjectionResult)>;
+
         /**
          * @brief Constructs the multi-scenario projection engine.
          *
@@ -78,51 +130,323 @@ namespace ALM {
             step_(step) {
         }
 
+        /**
+         * @brief Constructs the engine over a scenario cube.
+         *
+         * Each scenario is projected on its step-0 curve through a ScenarioCurve view into the
+         * cube, so no curve objects are allocated per scenario.
+         *
+         * @param scenarios The scenario set (e.g. memory-mapped); shared, never copied.
+         */
+        MultiScenarioProjection(
+            Portfolio assets,
+            Portfolio liabilities,
+            std::shared_ptr<Strategy> strategy,
+            std::shared_ptr<TaskExecutor> executor,
+            std::shared_ptr<const ScenarioSet> scenarios,
+            Date start,
+            Date end,
+            Duration step = Duration(1, Duration::Unit::Months)) :
+            assets_(std::move(assets)),
+            liabilities_(std::move(liabilities)),
+            strategy_(std::move(strategy)),
+            executor_(std::move(executor)),
+            scenarios_(std::move(scenarios)),
+            start_(start),
+            end_(end),
+            step_(step) {
+        }
+
+        /**
+         * @brief Constructs the engine over a stream of generated scenarios.
+         *
+         * Curves are produced on demand by a dedicated producer thread and handed to the
+         * projection tasks through a bounded queue, so at most `capacity` generated curves are
+         * waiting at any time and none are materialized up front.
+         *
+         * @param scenario_count Number of scenarios to draw from the source.
+         * @param source Curve for a scenario index, e.g. ShortRateScenarioGenerator::scenario.
+         * @param capacity Maximum number of generated curves waiting to be projected.
+         */
+        MultiScenarioProjection(
+            Portfolio assets,
+            Portfolio liabilities,
+            std::shared_ptr<Strategy> strategy,
+            std::shared_ptr<TaskExecutor> executor,
+            size_t scenario_count,
+            ScenarioSource source,
+            Date start,
+            Date end,
+            Duration step = Duration(1, Duration::Unit::Months),
+            size_t capacity = 64) :
+            assets_(std::move(assets)),
+            liabilities_(std::move(liabilities)),
+            strategy_(std::move(strategy)),
+            executor_(std::move(executor)),
+            source_(std::move(source)),
+            source_count_(scenario_count),
+            capacity_(capacity),
+            start_(start),
+            end_(end),
+            step_(step) {
+        }
+
+        /**
+         * @brief Sets a token that stops run(), runAdaptive() and runMax() early, e.g. to honour
+         *        a latency budget.
+         *
+         * Scenarios not yet started are skipped and running ones stop at their next projection
+         * step. run() then leaves empty results for unfinished scenarios; status() reports how
+         * many finished.
+         */
+        void setCancellation(CancellationToken token) {
+            cancellation_ = std::move(token);
+        }
+
+        /// Completion status of the last batch run
+        const BatchStatus& status() const {
+            return status_;
+        }
+
+        /// Number of scenarios
+        size_t size() const {
+            if (source_) return source_count_;
+            return scenarios_ ? scenarios_->size() : curves_.size();
+        }
+
         /**
          * @brief Runs the projection over all scenarios.
          *
-         * For each curve:
-         * - The shared handle is relinked
+         * For each scenario:
          * - The optimal initial asset scale is solved
          * - A full projection is executed and stored
          *
-         * @return A vector of ProjectionResult objects, one per scenario.
+         * @return A vector of ProjectionResult objects, one per scenario, in curve order.
          */
         std::vector<ProjectionResult> run() {
-            std::vector<std::function<void()>> tasks;
+            return runRange(0, size());
+        }
 
-            std::vector<ProjectionResult> results;
-            std::mutex results_mutex;
+        /**
+         * @brief Runs the projection over all scenarios, streaming each result to a writer as
+         *        soon as its scenario finishes instead of keeping the histories in memory.
+         *
+         * Unfinished scenarios of a cancelled run are not written; status() reports them. The
+         * writer is left open, so several runs may append to one file before it is closed.
+         */
+        void run(ResultWriter& writer) {
+            runRange(0, size(), [&writer](size_t i, ProjectionResult result) {
+                writer.append(i, result);
+                });
+        }
 
-            StartingAssetSolver solver;
+        /**
+         * @brief Runs scenarios [first, first + count), passing each result to sink with its
+         *        index as soon as its scenario finishes, e.g. to project one shard of the set.
+         *
+         * Unfinished scenarios of a cancelled run are not passed; status() reports them.
+         * @throws std::out_of_range if the range extends past size().
+         */
+        void run(size_t first, size_t count, const ResultSink& sink) {
+            if (first > size() || count > size() - first)
+                throw std::out_of_range("MultiScenarioProjection: scenarios " + std::to_string(first) + "+"
+                    + std::to_string(count) + " out of " + std::to_string(size()));
+            runRange(first, count, sink);
+        }
 
-            for (size_t i = 0; i < curves_.size(); ++i) {
-                std::shared_ptr<YieldCurve> curve = curves_[i];
-                auto task = [&]() {
-                    Projection projection(
-                        assets_,
-                        liabilities_,
-                        strategy_,
-                        curve,
-                        start_,
-                        end_,
-                        step_);
-
-                    double scalar = solver.solve(projection);  // Solve for funding level
-                    auto result = projection.run(scalar); // Store the result
-                    {
-                        std::lock_guard<std::mutex> lock(results_mutex);
-                        results.push_back(result);
-                    }
-                };
+        /**
+         * @brief Runs scenarios in waves until the requested statistic has converged.
+         *
+         * Scenarios are taken in index order, up to size(). After each wave the statistic and its
+         * confidence interval are re-estimated; the run stops once the interval is within
+         * tolerance, otherwise the next wave is sized from the scenarios the current error
+         * implies are still needed (at least a quarter of the first wave, at most doubling the
+         * count so far). The first wave holds at least SequentialStopping::minimumScenarios(), so
+         * a tail expectation always has two tail scenarios; if the set is smaller than that the
+         * run returns unconverged without an estimate.
+         *
+         * @param stopping The statistic, tolerance and first wave size.
+         * @param metric Per-scenario value; the starting asset value by default.
+         */
+        AdaptiveProjection runAdaptive(const SequentialStopping& stopping, Metric metric = nullptr) {
+            if (!metric) {
+                metric = [](const ProjectionResult& result) {
+                    return result.assets_bop.empty() ? 0.0 : result.assets_bop.front();
+                    };
+            }
+            size_t group = std::max<size_t>(stopping.group_size, 1);
+            auto whole = [group](size_t n) { return (n + group - 1) / group * group; };
+
+            AdaptiveProjection adaptive;
+            std::vector<double> values;
+            size_t minimum = stopping.minimumScenarios();
+            size_t wave = whole(std::max(stopping.initial_scenarios, minimum));
+
+            while (true) {
+                size_t first = adaptive.results.size();
+                wave = std::min(wave, (size() - first) / group * group);
+                if (wave == 0) break;
+
+                std::vector<ProjectionResult> results = runRange(first, wave);
+                if (!status_.complete()) break;  // cancelled: keep the last complete estimate
 
-                tasks.push_back(task);
+                for (auto& result : results) {
+                    values.push_back(metric(result));
+                    adaptive.results.push_back(std::move(result));
+                }
+                ++adaptive.waves;
+                if (values.size() < minimum) break;  // scenarios ran out before the statistic is defined
 
+                adaptive.estimate = stopping.estimate(values);
+                adaptive.half_width = stopping.halfWidth(adaptive.estimate);
+                double tolerance = stopping.tolerance(adaptive.estimate);
+                if (adaptive.half_width <= tolerance) {
+                    adaptive.converged = true;
+                    break;
+                }
+
+                // Error shrinks as 1/sqrt(n); aim 10% past the projected count
+                double n = static_cast<double>(values.size());
+                double needed = tolerance > 0.0
+                    ? 1.1 * n * (adaptive.half_width / tolerance) * (adaptive.half_width / tolerance)
+                    : 2.0 * n;
+                double floor = std::min(static_cast<double>(stopping.initial_scenarios / 4), n);
+                double next = std::clamp(needed - n, floor, n);
+                wave = whole(static_cast<size_t>(std::ceil(next)));
             }
+            return adaptive;
+        }
+
+        /**
+         * @brief Largest required starting asset value across scenarios.
+         *
+         * Equivalent to the maximum of assets_bop[0] over run(), but scenarios are tried in order
+         * of a cheap proxy and each publishes its result to an atomic running maximum. A scenario
+         * is first projected at the scale that would just match the maximum; if its surplus is
+         * non-negative there it cannot exceed it and is skipped, and otherwise its solve is
+         * cancelled as soon as the solver's bracket falls below the maximum.
+         *
+         * Those solves start from brackets that depend on the order and timing, so their roots
+         * differ from run()'s within the solver tolerance. Every scenario that could still attain
+         * the maximum within that tolerance is therefore solved again on run()'s fixed bracket,
+         * and the largest of those is returned: the maximum is exactly run()'s, whatever the
+         * order and thread count, so it is safe to differentiate numerically.
+         *
+         * @param order Scenarios in the order to try them, typically MaxReduction::order from the
+         *              previous run on a nearby portfolio. If empty, scenarios are tried in
+         *              decreasing liability PV on their curve.
+         */
+        MaxReduction runMax(const std::vector<size_t>& order = {}) {
+            if (source_)
+                throw std::logic_error("MultiScenarioProjection: max reduction needs stored scenarios");
 
-            executor_->submitAndWait(tasks);
+            size_t n = size();
+            std::vector<size_t> sequence(order);
+            bool ranked = sequence.size() == n;
 
-            return results;
+            // Starting asset value at scale 1, which converts scales to values, and the proxy
+            std::vector<double> units(n), proxy(n);
+            {
+                std::vector<std::function<void()>> tasks;
+                for (size_t i = 0; i < n; ++i) {
+                    tasks.push_back([this, i, ranked, &units, &proxy]() {
+                        withKernel(i, [&](auto&, const auto& curve) {
+                            units[i] = assets_.marketValue(curve, start_);
+                            if (!ranked) proxy[i] = liabilities_.marketValue(curve, start_);
+                            });
+                        });
+                }
+                status_ = executor_->submitAndWait(tasks, cancellation_);
+                if (!status_.complete()) {
+                    MaxReduction reduction;
+                    reduction.complete = false;
+                    return reduction;
+                }
+            }
+
+            if (!ranked) {
+                sequence.resize(n);
+                std::iota(sequence.begin(), sequence.end(), size_t(0));
+                std::stable_sort(sequence.begin(), sequence.end(),
+                    [&proxy](size_t a, size_t b) { return proxy[a] > proxy[b]; });
+            }
+
+            // Values within `margin` of the maximum are re-solved by polish(); pruning against the
+            // maximum less twice that keeps scenarios pruned here out of it
+            double margin = 0.0;
+            for (double unit : units) {
+                margin = std::max(margin, 4.0 * BrentSolver::DefaultTolerance * unit);
+            }
+
+            MaxReduction reduction;
+            std::atomic<double> maximum(0.0);
+            std::atomic<size_t> solved(0), pruned(0);
+            std::vector<std::optional<double>> values(n);
+            std::vector<double> bounds(n, 0.0);     // Proven upper bound on each scenario's value
+            std::mutex best_mutex;
+
+            std::vector<std::function<void()>> tasks;
+            for (size_t i : sequence) {
+                tasks.push_back([&, i]() {
+                    ALM_TRACE_SCOPE("scenario", "MultiScenarioProjection::maxScenario");
+                    withKernel(i, [&](auto& kernel, const auto&) {
+                        double unit_value = units[i];
+                        // The last threshold read is the one a pruned scenario was shown to fall below
+                        double threshold = 0.0;
+                        StartingAssetSolver solver;
+                        std::optional<double> scalar = solver.solveAbove(kernel, [&]() {
+                            double target = maximum.load(std::memory_order_relaxed) - 2.0 * margin;
+                            threshold = unit_value > 0.0 ? std::max(target, 0.0) / unit_value : 0.0;
+                            return threshold;
+                            });
+                        if (!scalar) {
+                            bounds[i] = threshold * unit_value;
+                            ++pruned;
+                            return;
+                        }
+
+                        ProjectionResult result = kernel.run(*scalar);
+                        double value = result.assets_bop.front();
+                        values[i] = value;
+                        bounds[i] = value;
+                        ++solved;
+
+                        std::lock_guard lock(best_mutex);
+                        if (value > maximum.load(std::memory_order_relaxed)) {
+                            maximum.store(value, std::memory_order_relaxed);
+                            reduction.scenario = i;
+                            reduction.result = std::move(result);
+                        }
+                        });
+                    });
+            }
+            status_ = executor_->submitAndWait(tasks, cancellation_);
+
+            reduction.maximum = maximum.load();
+            reduction.complete = status_.complete();
+            reduction.solved = solved.load();
+            reduction.pruned = pruned.load();
+            if (reduction.complete && n > 0)
+                polish(reduction, values, bounds, margin);
+
+            // Solved scenarios by decreasing value, then the rest in the order they were tried
+            reduction.order = sequence;
+            std::stable_sort(reduction.order.begin(), reduction.order.end(), [&values](size_t a, size_t b) {
+                return values[a].value_or(-std::numeric_limits<double>::infinity())
+                    > values[b].value_or(-std::numeric_limits<double>::infinity());
+                });
+            return reduction;
+        }
+
+        /**
+         * @brief Solves the funding level and runs the projection for a single scenario.
+         *
+         * @param i Scenario index.
+         * @return The projection at the solved starting asset scale.
+         */
+        ProjectionResult runScenario(size_t i) const {
+            ALM_TRACE_SCOPE("scenario", "MultiScenarioProjection::scenario");
+            return withKernel(i, [](auto& kernel, const auto&) { return solveAndRun(kernel); });
         }
 
     private:
@@ -131,9 +455,188 @@ namespace ALM {
         std::shared_ptr<Strategy> strategy_;
         std::shared_ptr<TaskExecutor> executor_;
         std::vector<std::shared_ptr<YieldCurve>> curves_;
+        std::shared_ptr<const ScenarioSet> scenarios_;
+        ScenarioSource source_;
+        size_t source_count_ = 0;
+        size_t capacity_ = 0;
+        CancellationToken cancellation_;
+        BatchStatus status_;
         Date start_;
         Date end_;
         Duration step_;
+
+        // Stateful strategies get a private copy per scenario
+        std::shared_ptr<Strategy> scenarioStrategy() const {
+            std::shared_ptr<Strategy> strategy = strategy_ ? strategy_->clone() : nullptr;
+            return strategy ? strategy : strategy_;
+        }
+
+        ProjectionResult runCurve(const std::shared_ptr<const YieldCurve>& curve) const {
+            ALM_TRACE_SCOPE("scenario", "MultiScenarioProjection::scenario");
+            return withKernel(curve, [](auto& kernel, const auto&) { return solveAndRun(kernel); });
+        }
+
+        /**
+         * Re-solves, on run()'s bracket, every scenario whose bound lies within `margin` of the
+         * maximum, and replaces the maximum with the largest of them. Both solves are within the
+         * solver tolerance of the root on the scale, so the margin of four tolerances times the
+         * largest unit value always admits the scenario attaining run()'s maximum. Ties go to the
+         * lowest index.
+         */
+        void polish(MaxReduction& reduction, std::vector<std::optional<double>>& values,
+            const std::vector<double>& bounds, double margin) {
+            std::vector<size_t> candidates;
+            for (size_t i = 0; i < bounds.size(); ++i) {
+                if (bounds[i] >= reduction.maximum - margin) candidates.push_back(i);
+            }
+
+            std::vector<ProjectionResult> results(candidates.size());
+            std::vector<std::function<void()>> tasks;
+            for (size_t k = 0; k < candidates.size(); ++k) {
+                tasks.push_back([this, k, &candidates, &results]() {
+                    results[k] = runScenario(candidates[k]);
+                    });
+            }
+            status_ = executor_->submitAndWait(tasks, cancellation_);
+            if (!status_.complete()) {
+                reduction.complete = false;
+                return;
+            }
+
+            size_t best = 0;
+            for (size_t k = 1; k < candidates.size(); ++k) {
+                if (results[k].assets_bop.front() > results[best].assets_bop.front()) best = k;
+            }
+            for (size_t k = 0; k < candidates.size(); ++k) {
+                values[candidates[k]] = results[k].assets_bop.front();
+            }
+            reduction.maximum = results[best].assets_bop.front();
+            reduction.scenario = candidates[best];
+            reduction.result = std::move(results[best]);
+            reduction.polished = candidates.size();
+        }
+
+        template <typename Fn>
+        using KernelResult = std::invoke_result_t<Fn&, ProjectionKernel<YieldCurve, DynamicStrategy>&, const YieldCurve&>;
+
+        /// Calls fn(kernel, curve) with the projection kernel for scenario i
+        template <typename Fn>
+        KernelResult<Fn> withKernel(size_t i, Fn&& fn) const {
+            if (scenarios_) {
+                std::shared_ptr<Strategy> strategy = scenarioStrategy();
+                ScenarioCurve curve = scenarios_->curve(i);
+                std::shared_ptr<const YieldCurve> handle(std::shared_ptr<const YieldCurve>(), &curve);  // non-owning
+                ProjectionKernel<ScenarioCurve, DynamicStrategy> kernel(
+                    assets_, liabilities_, DynamicStrategy(strategy.get(), handle), curve, start_, end_, step_);
+                kernel.setCancellation(cancellation_);
+                return fn(kernel, curve);
+            }
+
+            return withKernel(source_ ? source_(i) : curves_[i], std::forward<Fn>(fn));
+        }
+
+        template <typename Fn>
+        KernelResult<Fn> withKernel(const std::shared_ptr<const YieldCurve>& curve, Fn&& fn) const {
+            std::shared_ptr<Strategy> strategy = scenarioStrategy();
+            ProjectionKernel<YieldCurve, DynamicStrategy> kernel(
+                assets_, liabilities_, DynamicStrategy(strategy.get(), curve), *curve, start_, end_, step_);
+            kernel.setCancellation(cancellation_);
+            return fn(kernel, *curve);
+        }
+
+        std::vector<ProjectionResult> runRange(size_t first, size_t count) {
+            std::vector<ProjectionResult> results(count);
+            runRange(first, count, [first, &results](size_t i, ProjectionResult result) {
+                results[i - first] = std::move(result);
+                });
+            return results;
+        }
+
+        /// Runs scenarios [first, first + count), passing each result to sink with its index
+        void runRange(size_t first, size_t count, const ResultSink& sink) {
+            if (source_) {
+                runStreaming(first, count, sink);
+                return;
+            }
+
+            std::vector<std::function<void()>> tasks;
+
+            for (size_t i = 0; i < count; ++i) {
+                tasks.push_back([this, first, i, &sink]() {
+                    sink(first + i, runScenario(first + i));
+                    });
+            }
+
+            status_ = executor_->submitAndWait(tasks, cancellation_);
+        }
+
+        /**
+         * Producer/consumer run: one thread generates curves in index order into a bounded queue;
+         * each executor task takes the next curve and passes its result to the sink.
+         * The first exception from either side stops generation and is rethrown once all
+         * in-flight work has finished.
+         */
+        void runStreaming(size_t first, size_t count, const ResultSink& sink) {
+            using Item = std::pair<size_t, std::shared_ptr<const YieldCurve>>;
+            BoundedQueue<Item> queue(capacity_);
+            std::exception_ptr producer_error;
+
+            std::thread producer([&]() {
+                try {
+                    for (size_t i = 0; i < count && !cancellation_.cancelled(); ++i) {
+                        std::shared_ptr<const YieldCurve> curve;
+                        {
+                            ALM_TRACE_SCOPE("scenario", "MultiScenarioProjection::generate");
+                            curve = source_(first + i);
+                        }
+                        if (!queue.push(Item(i, std::move(curve)))) break;
+                    }
+                }
+                catch (...) {
+                    producer_error = std::current_exception();
+                }
+                queue.close();
+                });
+
+            std::exception_ptr consumer_error;
+            std::mutex error_mutex;
+
+            std::vector<std::function<void()>> tasks;
+            for (size_t t = 0; t < count; ++t) {
+                tasks.push_back([&]() {
+                    auto item = queue.pop();
+                    if (!item) {
+                        cancellation_.throwIfCancelled();
+                        return;
+                    }
+                    try {
+                        sink(first + item->first, runCurve(item->second));
+                    }
+                    catch (const OperationCancelled&) {
+                        throw;
+                    }
+                    catch (...) {
+                        std::lock_guard lock(error_mutex);
+                        if (!consumer_error) consumer_error = std::current_exception();
+                        queue.close();
+                    }
+                    });
+            }
+
+            status_ = executor_->submitAndWait(tasks, cancellation_);
+            queue.close();
+            producer.join();
+
+            if (producer_error) std::rethrow_exception(producer_error);
+            if (consumer_error) std::rethrow_exception(consumer_error);
+        }
+
+        template <typename ProjectionT>
+        static ProjectionResult solveAndRun(ProjectionT& projection) {
+            StartingAssetSolver solver;
+            double scalar = solver.solve(projection);  // Solve for funding level
+            return projection.run(scalar);
+        }
     };
 
 }
@@ -24,17 +24,27 @@
 
 #pragma once
 
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
 #include <windows.h>
+#endif
 #include <vector>
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <atomic>
 #include <mutex>
 #include <thread>
 #include "TaskExecutor.h"
+#include "ThreadPoolExecutor.h"
+#include "Trace.h"
 
 namespace ALM {
 
+#ifdef _WIN32
+
     /**
      * @brief Executor that uses the Windows thread pool for concurrent task execution.
      */
@@ -58,8 +68,12 @@ namespace ALM {
             CloseThreadpool(thread_pool_);
         }
 
+        using TaskExecutor::submitAndWait;
+
         void submitAndWait(const std::vector<std::function<void()>>& tasks) override {
             if (tasks.empty()) return;
+            ALM_TRACE_SCOPE("executor", "MultiThreadedExecutor::submitAndWait");
+            ALM_TRACE_COUNTER("executor", "MultiThreadedExecutor::batchSize", tasks.size());
 
             HANDLE event = CreateEvent(nullptr, TRUE, FALSE, nullptr);
             std::atomic<size_t> remaining(tasks.size());
@@ -71,7 +85,10 @@ namespace ALM {
                     [](PTP_CALLBACK_INSTANCE, void* param, PTP_WORK) {
                         // Take back ownership of the context
                         std::unique_ptr<TaskContext> ctx(reinterpret_cast<TaskContext*>(param));
-                        ctx->task();
+                        {
+                            ALM_TRACE_SCOPE("executor", "MultiThreadedExecutor::task");
+                            ctx->task();
+                        }
 
                         if (--(*ctx->remaining) == 0) {
                             SetEvent(ctx->event);
@@ -100,4 +117,24 @@ namespace ALM {
         TP_CALLBACK_ENVIRON environment_;
     };
 
+#else
+
+    /**
+     * @brief Portable stand-in where the Windows thread pool is unavailable.
+     *
+     * Runs on a ThreadPoolExecutor sized to max_threads, so code written against
+     * MultiThreadedExecutor builds and runs unchanged on other platforms.
+     */
+    class MultiThreadedExecutor : public ThreadPoolExecutor {
+    public:
+        MultiThreadedExecutor(
+            size_t min_threads = 1,
+            size_t max_threads = std::thread::hardware_concurrency())
+            : ThreadPoolExecutor(std::max(min_threads, max_threads))
+        {
+        }
+    };
+
+#endif
+
 }
@@ -0,0 +1,361 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <utility>
+#include <unordered_map>
+#include <stdexcept>
+
+#include "Date.h"
+#include "Asset.h"
+#include "Portfolio.h"
+#include "Strategy.h"
+#include "TaskExecutor.h"
+#include "ProjectionKernel.h"
+#include "MultiScenarioProjection.h"
+#include "YieldCurve.h"
+#include "Trace.h"
+
+namespace ALM {
+
+    /**
+     * @brief Resolution at which outer-path states are treated as equal for inner-result reuse.
+     *
+     * A node is keyed by its date, the zero rates of the outer curve as seen from the node at the
+     * given tenors, the cash-flow duration of the assets held, and cash as a share of assets,
+     * each rounded to its bucket. A bucket of zero keys on the exact value. The asset scale is
+     * not part of the key, as the default inner metric (required starting assets) does not
+     * depend on it.
+     */
+    struct NestedStateGrid {
+        std::vector<Duration> tenors = {
+            Duration(1, Duration::Unit::Years),
+            Duration(5, Duration::Unit::Years),
+            Duration(10, Duration::Unit::Years),
+            Duration(30, Duration::Unit::Years) };
+        double rate_bucket = 1e-4;          ///< 1bp
+        double duration_bucket = 0.05;      ///< Years
+        double cash_bucket = 1e-3;          ///< Share of node assets
+    };
+
+    /**
+     * @brief Outer paths with the inner valuation at each of their nodes.
+     */
+    struct NestedResult {
+        std::vector<ProjectionResult> outer;            ///< Outer projections, one per outer curve
+        std::vector<Date> nodes;                        ///< Valuation dates
+        std::vector<std::vector<double>> values;        ///< Inner valuation [outer][node]
+        std::vector<std::vector<double>> assets;        ///< Assets held, cash included [outer][node]
+        size_t inner_sets = 0;                          ///< Inner scenario sets projected by this run
+        size_t cache_hits = 0;                          ///< Reached nodes valued from an earlier run or another node's inner set
+    };
+
+    /**
+     * @brief Nested-stochastic driver: inner multi-scenario valuations at the nodes of outer paths.
+     *
+     * Each outer curve is projected from the actual portfolio (scale 1) and its state (assets and
+     * cash) captured at every valuation date. At a node, the inner scenarios for that date are
+     * projected from the captured assets, with cash carried as an overnight deposit; each inner
+     * scenario solves its required starting assets as in MultiScenarioProjection, and the inner
+     * values are averaged.
+     *
+     * Work runs in three flat batches on one executor so no task waits on another batch: the outer
+     * paths, the generation of inner scenario sets, then every (node, inner scenario) projection.
+     * Inner results are cached by quantized node state (see NestedStateGrid) across nodes, paths
+     * and calls to run(), so only distinct states are valued.
+     */
+    class NestedProjection {
+    public:
+        /// Inner curves for a node, given its date and the curve of the outer path it lies on
+        using InnerScenarios = std::function<std::vector<std::shared_ptr<YieldCurve>>(const Date&, const std::shared_ptr<YieldCurve>&)>;
+
+        /// Per-inner-scenario value averaged into the node value; required starting assets by default
+        using InnerMetric = std::function<double(const ProjectionResult&)>;
+
+        /**
+         * @param assets Starting assets of every outer path.
+         * @param liabilities Liabilities, shared by outer and inner projections.
+         * @param strategy Reinvestment/disinvestment strategy for outer and inner projections.
+         * @param executor Executor for all three stages.
+         * @param outer_curves Outer (real-world) scenarios.
+         * @param inner_scenarios Inner (valuation) scenarios at a node.
+         * @param start Projection start date.
+         * @param end Projection end date, for outer and inner projections alike.
+         * @param step Projection step.
+         * @param valuation_step Spacing of the nodes, a whole number of steps. Nodes are the
+         *                       projection's own step dates, exclusive of start and end, so
+         *                       month-end clamping moves them as it moves the steps.
+         * @param grid State resolution for the inner-result cache.
+         * @throws std::invalid_argument if the step is not positive or valuation_step is not a
+         *         whole number of steps.
+         */
+        NestedProjection(
+            Portfolio assets,
+            Portfolio liabilities,
+            std::shared_ptr<Strategy> strategy,
+            std::shared_ptr<TaskExecutor> executor,
+            std::vector<std::shared_ptr<YieldCurve>> outer_curves,
+            InnerScenarios inner_scenarios,
+            Date start,
+            Date end,
+            Duration step = Duration(1, Duration::Unit::Months),
+            Duration valuation_step = Duration(1, Duration::Unit::Years),
+            NestedStateGrid grid = NestedStateGrid()) :
+            assets_(std::move(assets)),
+            liabilities_(std::move(liabilities)),
+            strategy_(std::move(strategy)),
+            executor_(std::move(executor)),
+            outer_curves_(std::move(outer_curves)),
+            inner_scenarios_(std::move(inner_scenarios)),
+            start_(start),
+            end_(end),
+            step_(step),
+            grid_(std::move(grid)) {
+            int per_node = stepsPerNode(step_, valuation_step);
+            if (per_node == 0)
+                throw std::invalid_argument("NestedProjection: the valuation step must be a positive whole number of projection steps");
+
+            // Steps exactly as ProjectionKernel does, so every node is a date the outer paths visit
+            Date date = start_;
+            for (int i = 1; ; ++i) {
+                date = date + step_;
+                if (date >= end_) break;
+                if (i % per_node == 0) nodes_.push_back(date);
+            }
+        }
+
+        /// Replaces the per-inner-scenario metric; clears the cache, whose values it determines
+        void setInnerMetric(InnerMetric metric) {
+            metric_ = std::move(metric);
+            clearCache();
+        }
+
+        size_t cacheSize() const {
+            return cache_.size();
+        }
+
+        void clearCache() {
+            cache_.clear();
+        }
+
+        NestedResult run() {
+            size_t outer_count = outer_curves_.size();
+            size_t node_count = nodes_.size();
+
+            NestedResult result;
+            result.nodes = nodes_;
+            result.outer.resize(outer_count);
+            result.values.assign(outer_count, std::vector<double>(node_count, 0.0));
+            result.assets.assign(outer_count, std::vector<double>(node_count, 0.0));
+
+            // Outer paths, capturing the state at each node
+            std::vector<std::vector<Node>> states(outer_count, std::vector<Node>(node_count));
+            std::vector<std::function<void()>> tasks;
+            for (size_t p = 0; p < outer_count; ++p) {
+                tasks.push_back([this, p, &states, &result]() {
+                    ALM_TRACE_SCOPE("scenario", "NestedProjection::outer");
+                    const std::shared_ptr<YieldCurve>& curve = outer_curves_[p];
+                    std::shared_ptr<Strategy> strategy = scenarioStrategy();
+                    ProjectionKernel<YieldCurve, DynamicStrategy> kernel(
+                        assets_, liabilities_, DynamicStrategy(strategy.get(), curve), *curve, start_, end_, step_);
+
+                    size_t k = 0;
+                    result.outer[p] = kernel.run(1.0, [&](const Date& date, const Portfolio& portfolio, double cash) {
+                        if (k == nodes_.size() || date != nodes_[k]) return;
+                        states[p][k] = capture(date, portfolio, cash, *curve);
+                        result.assets[p][k] = states[p][k].assets_mv;
+                        ++k;
+                        });
+                    });
+            }
+            executor_->submitAndWait(tasks);
+
+            // Distinct uncached states, each valued once
+            std::vector<std::pair<const Node*, size_t>> jobs;  // node and its outer path
+            std::unordered_map<NodeKey, size_t, NodeKeyHash> job_index;
+            size_t captured = 0;  // nodes reached by their outer path
+            for (size_t p = 0; p < outer_count; ++p) {
+                for (size_t k = 0; k < node_count; ++k) {
+                    const Node& node = states[p][k];
+                    if (node.key.fields.empty()) continue;  // path ended before the node
+                    ++captured;
+                    if (cache_.count(node.key)) continue;
+                    if (job_index.emplace(node.key, jobs.size()).second) {
+                        jobs.emplace_back(&node, p);
+                    }
+                }
+            }
+
+            // Inner scenario sets
+            std::vector<std::vector<std::shared_ptr<YieldCurve>>> inner(jobs.size());
+            tasks.clear();
+            for (size_t j = 0; j < jobs.size(); ++j) {
+                tasks.push_back([this, j, &jobs, &inner]() {
+                    inner[j] = inner_scenarios_(jobs[j].first->date, outer_curves_[jobs[j].second]);
+                    });
+            }
+            executor_->submitAndWait(tasks);
+
+            // Every (node, inner scenario) projection in one batch
+            std::vector<MultiScenarioProjection> valuations;
+            valuations.reserve(jobs.size());
+            for (size_t j = 0; j < jobs.size(); ++j) {
+                valuations.emplace_back(jobs[j].first->assets, liabilities_, strategy_, executor_,
+                    inner[j], jobs[j].first->date, end_, step_);
+            }
+
+            std::vector<std::vector<double>> inner_values(jobs.size());
+            tasks.clear();
+            for (size_t j = 0; j < jobs.size(); ++j) {
+                inner_values[j].resize(inner[j].size());
+                for (size_t i = 0; i < inner[j].size(); ++i) {
+                    tasks.push_back([this, j, i, &valuations, &inner_values]() {
+                        inner_values[j][i] = metric_(valuations[j].runScenario(i));
+                        });
+                }
+            }
+            executor_->submitAndWait(tasks);
+
+            for (size_t j = 0; j < jobs.size(); ++j) {
+                double total = 0.0;
+                for (double v : inner_values[j]) total += v;
+                cache_[jobs[j].first->key] = inner_values[j].empty() ? 0.0 : total / inner_values[j].size();
+            }
+            result.inner_sets = jobs.size();
+
+            for (size_t p = 0; p < outer_count; ++p) {
+                for (size_t k = 0; k < node_count; ++k) {
+                    auto it = cache_.find(states[p][k].key);
+                    if (it == cache_.end()) continue;  // path ended before the node
+                    result.values[p][k] = it->second;
+                }
+            }
+            result.cache_hits = captured - result.inner_sets;
+            return result;
+        }
+
+    private:
+        struct NodeKey {
+            std::vector<int64_t> fields;
+
+            bool operator==(const NodeKey& other) const {
+                return fields == other.fields;
+            }
+        };
+
+        struct NodeKeyHash {
+            size_t operator()(const NodeKey& key) const {
+                size_t hash = 0;
+                for (int64_t field : key.fields) {
+                    hash ^= std::hash<int64_t>()(field) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+                }
+                return hash;
+            }
+        };
+
+        struct Node {
+            Date date;
+            Portfolio assets;           ///< Assets held, with cash as an overnight deposit
+            double assets_mv = 0.0;
+            NodeKey key;
+        };
+
+        Portfolio assets_;
+        Portfolio liabilities_;
+        std::shared_ptr<Strategy> strategy_;
+        std::shared_ptr<TaskExecutor> executor_;
+        std::vector<std::shared_ptr<YieldCurve>> outer_curves_;
+        InnerScenarios inner_scenarios_;
+        InnerMetric metric_ = [](const ProjectionResult& result) {
+            return result.assets_bop.empty() ? 0.0 : result.assets_bop.front();
+            };
+        Date start_;
+        Date end_;
+        Duration step_;
+        NestedStateGrid grid_;
+        std::vector<Date> nodes_;
+        std::unordered_map<NodeKey, double, NodeKeyHash> cache_;
+
+        // Projection steps per valuation step, or 0 unless that is a positive whole number
+        static int stepsPerNode(const Duration& step, const Duration& valuation_step) {
+            auto months = [](const Duration& d) { return d.unit == Duration::Unit::Years ? 12 * d.amount : d.amount; };
+            if (step.amount <= 0 || valuation_step.amount <= 0) return 0;
+            if ((step.unit == Duration::Unit::Days) != (valuation_step.unit == Duration::Unit::Days)) return 0;
+            int a = months(step), b = months(valuation_step);
+            return b % a == 0 ? b / a : 0;
+        }
+
+        std::shared_ptr<Strategy> scenarioStrategy() const {
+            std::shared_ptr<Strategy> strategy = strategy_ ? strategy_->clone() : nullptr;
+            return strategy ? strategy : strategy_;
+        }
+
+        Node capture(const Date& date, const Portfolio& portfolio, double cash, const YieldCurve& curve) const {
+            Node node;
+            node.date = date;
+            node.assets = portfolio;
+            if (cash != 0.0) {
+                node.assets.addAsset(Asset({ { date + Duration(1, Duration::Unit::Days), cash } }));
+            }
+
+            // Cash-flow duration of the assets held
+            double pv = 0.0, weighted = 0.0;
+            double df_node = curve.discount(date);
+            for (size_t i = 0; i < portfolio.size(); ++i) {
+                for (const auto& cf : portfolio.asset(i).cashFlows()) {
+                    if (cf.date < date) continue;
+                    double value = portfolio.volume(i) * cf.amount * curve.discount(cf.date) / df_node;
+                    pv += value;
+                    weighted += value * (cf.date - date) / 365.0;
+                }
+            }
+            node.assets_mv = pv + cash;
+
+            node.key.fields.push_back(date.serial());
+            for (const Duration& tenor : grid_.tenors) {
+                Date maturity = date + tenor;
+                double zero = -std::log(curve.discount(maturity) / df_node) * 365.0 / (maturity - date);
+                node.key.fields.push_back(quantize(zero, grid_.rate_bucket));
+            }
+            node.key.fields.push_back(quantize(pv > 0.0 ? weighted / pv : 0.0, grid_.duration_bucket));
+            node.key.fields.push_back(quantize(node.assets_mv != 0.0 ? cash / node.assets_mv : 0.0, grid_.cash_bucket));
+            return node;
+        }
+
+        static int64_t quantize(double value, double bucket) {
+            if (bucket > 0.0) return std::llround(value / bucket);
+            int64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+    };
+
+}
@@ -0,0 +1,165 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+
+namespace ALM {
+
+    class Observer;
+
+    /**
+     * @brief Object that notifies registered observers when it changes.
+     *
+     * Observers are held by raw pointer and unregister themselves on destruction; they in turn
+     * hold the observables they watch by shared_ptr, so an observable outlives its observers'
+     * interest in it. Notification runs on the notifying thread while the observer list is
+     * locked, so update() must not register or unregister with the same observable.
+     */
+    class Observable {
+    public:
+        Observable() = default;
+        Observable(const Observable&) = delete;
+        Observable& operator=(const Observable&) = delete;
+        virtual ~Observable() = default;
+
+        void notifyObservers();
+
+    private:
+        friend class Observer;
+
+        void attach(Observer* observer) {
+            std::lock_guard lock(mutex_);
+            observers_.push_back(observer);
+        }
+
+        void detach(Observer* observer) {
+            std::lock_guard lock(mutex_);
+            auto it = std::find(observers_.begin(), observers_.end(), observer);
+            if (it != observers_.end()) observers_.erase(it);
+        }
+
+        std::vector<Observer*> observers_;
+        std::mutex mutex_;
+    };
+
+    /**
+     * @brief Object that is told, through update(), when an observable it watches changes.
+     */
+    class Observer {
+    public:
+        Observer() = default;
+        Observer(const Observer&) = delete;
+        Observer& operator=(const Observer&) = delete;
+
+        virtual ~Observer() {
+            for (const auto& observable : observables_) {
+                observable->detach(this);
+            }
+        }
+
+        void registerWith(const std::shared_ptr<Observable>& observable) {
+            if (!observable) return;
+            if (std::find(observables_.begin(), observables_.end(), observable) != observables_.end()) return;
+            observable->attach(this);
+            observables_.push_back(observable);
+        }
+
+        void unregisterWith(const std::shared_ptr<Observable>& observable) {
+            auto it = std::find(observables_.begin(), observables_.end(), observable);
+            if (it == observables_.end()) return;
+            observable->detach(this);
+            observables_.erase(it);
+        }
+
+        /// Called when an observed object changes
+        virtual void update() = 0;
+
+    private:
+        std::vector<std::shared_ptr<Observable>> observables_;
+    };
+
+    inline void Observable::notifyObservers() {
+        std::lock_guard lock(mutex_);
+        for (Observer* observer : observers_) {
+            observer->update();
+        }
+    }
+
+    /**
+     * @brief Cached calculation that is invalidated by its inputs and recomputed on demand.
+     *
+     * update() only marks the result stale and forwards the notification to dependents; the
+     * work happens in performCalculations() the next time calculate() is called, so a chain of
+     * caches recomputes only the links whose inputs changed, and only if they are read.
+     * Recalculation is serialized; an update arriving during one leaves the result stale.
+     */
+    class LazyObject : public Observable, public Observer {
+    public:
+        void update() override {
+            version_.fetch_add(1, std::memory_order_acq_rel);
+            notifyObservers();
+        }
+
+        /// Whether the cached result reflects the latest inputs
+        bool isCalculated() const {
+            return calculated_version_.load(std::memory_order_acquire) == version_.load(std::memory_order_acquire);
+        }
+
+        /// Number of times performCalculations() has run
+        size_t recalculations() const {
+            return recalculations_.load(std::memory_order_relaxed);
+        }
+
+    protected:
+        LazyObject() = default;
+
+        void calculate() const {
+            if (isCalculated()) return;
+
+            std::lock_guard lock(calculation_mutex_);
+            uint64_t version = version_.load(std::memory_order_acquire);
+            if (calculated_version_.load(std::memory_order_relaxed) == version) return;
+
+            performCalculations();
+            recalculations_.fetch_add(1, std::memory_order_relaxed);
+            calculated_version_.store(version, std::memory_order_release);
+        }
+
+        virtual void performCalculations() const = 0;
+
+    private:
+        std::atomic<uint64_t> version_{ 1 };
+        mutable std::atomic<uint64_t> calculated_version_{ 0 };
+        mutable std::atomic<size_t> recalculations_{ 0 };
+        mutable std::mutex calculation_mutex_;
+    };
+
+}
@@ -0,0 +1,263 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+#include "Date.h"
+#include "DayCounter.h"
+#include "Calendar.h"
+#include "CashFlowBuilder.h"
+#include "BrentSolver.h"
+#include "TaskExecutor.h"
+#include "YieldCurve.h"
+#include "InterpolatedCurve.h"
+
+namespace ALM {
+
+    /**
+     * @brief Bootstraps log-linear discount curves from par rates at a fixed set of tenors.
+     *
+     * Pillar i is a par bond issued at the reference date maturing at reference + tenors[i],
+     * with the coupon schedule of CashFlowBuilder::fixedRateBond and coupons accrued on the day
+     * counter. Pillars are solved in order for the discount factor that prices the bond at par.
+     * The schedule is laid out once at construction: each coupon date is mapped to its pillar
+     * segment and log-linear weight, so a scenario only sums known discount factors. When no
+     * coupon falls strictly inside the segment being solved the pillar is solved analytically;
+     * otherwise BrentSolver finds it. All resulting curves share one InterpolatedCurve::Layout, so
+     * building a curve costs one exponential per grid point and no day counting.
+     *
+     * The bootstrapper is immutable after construction and may be shared across threads.
+     */
+    class ParCurveBootstrapper {
+    public:
+        /**
+         * @param ref Curve reference date and bond issue date.
+         * @param tenors Pillar tenors; maturities must be strictly increasing.
+         * @param frequency Coupon frequency of the par instruments.
+         * @param dc Day counter for coupon accrual and curve year fractions.
+         * @param calendar Calendar for the coupon schedule.
+         * @param grid_days Lookup grid spacing of the resulting curves, see InterpolatedCurve.
+         */
+        ParCurveBootstrapper(
+            Date ref,
+            std::vector<Duration> tenors,
+            Duration frequency = Duration(6, Duration::Unit::Months),
+            DayCounter dc = DayCounter(DayCounter::Convention::ActualActual),
+            const Calendar& calendar = Calendar(),
+            int grid_days = 1)
+            : ref_(ref), dc_(dc) {
+            if (tenors.empty())
+                throw std::invalid_argument("ParCurveBootstrapper: at least one tenor is required");
+
+            std::vector<double> x(1, 0.0);  // node year fractions, node 0 is the reference date
+            for (const auto& tenor : tenors) {
+                // Only the dates are used: the zero notional makes every amount 0, and the last
+                // flow is the principal at maturity
+                auto flows = CashFlowBuilder::fixedRateBond(ref_, ref_ + tenor, 1.0, 0.0, frequency, calendar, dc_);
+                Date maturity = flows.back().date;
+                if (!pillars_.empty() && maturity <= pillars_.back())
+                    throw std::invalid_argument("ParCurveBootstrapper: tenors must give increasing maturities");
+                if (maturity <= ref_)
+                    throw std::invalid_argument("ParCurveBootstrapper: tenors must mature after the reference date");
+
+                pillars_.push_back(maturity);
+                x.push_back(dc_.yearFraction(ref_, maturity));
+                size_t k = pillars_.size();  // node being solved
+
+                Pillar pillar;
+                Date accrual_start = ref_;
+                for (size_t i = 0; i + 1 < flows.size(); ++i) {
+                    const Date& pay = flows[i].date;
+                    Coupon coupon;
+                    coupon.accrual = dc_.yearFraction(accrual_start, pay);
+                    accrual_start = pay;
+
+                    double yf = dc_.yearFraction(ref_, pay);
+                    coupon.segment = static_cast<size_t>(std::lower_bound(x.begin(), x.end(), yf) - x.begin());
+                    coupon.segment = std::clamp<size_t>(coupon.segment, 1, k) - 1;
+                    coupon.weight = (yf - x[coupon.segment]) / (x[coupon.segment + 1] - x[coupon.segment]);
+
+                    if (coupon.segment + 1 < k)
+                        pillar.known.push_back(coupon);
+                    else if (coupon.weight >= 1.0)
+                        pillar.at_maturity += coupon.accrual;
+                    else
+                        pillar.inside.push_back(coupon);
+                }
+                layout_.push_back(std::move(pillar));
+            }
+
+            curve_layout_ = std::make_shared<const InterpolatedCurve::Layout>(ref_, pillars_, dc_, grid_days);
+        }
+
+        /// Pillar maturity dates
+        const std::vector<Date>& pillars() const {
+            return pillars_;
+        }
+
+        /**
+         * @brief Solves the pillar discount factors for one set of par rates.
+         *
+         * @param par_rates Annual par rate per tenor.
+         * @return Discount factor at each pillar.
+         */
+        std::vector<double> discountFactors(const std::vector<double>& par_rates) const {
+            if (par_rates.size() != layout_.size())
+                throw std::invalid_argument("ParCurveBootstrapper: need one par rate per tenor");
+
+            // Log discount factors by node; node 0 is the reference date
+            std::vector<double> y(layout_.size() + 1, 0.0);
+            auto known = [&](const Coupon& c) {
+                return std::exp(y[c.segment] + c.weight * (y[c.segment + 1] - y[c.segment]));
+                };
+
+            std::vector<double> discounts(layout_.size());
+            for (size_t k = 1; k <= layout_.size(); ++k) {
+                const Pillar& pillar = layout_[k - 1];
+                double rate = par_rates[k - 1];
+
+                double annuity = 0.0;
+                for (const auto& c : pillar.known) {
+                    annuity += c.accrual * known(c);
+                }
+
+                // 1 = rate * (annuity + inside(D) + at_maturity * D) + D
+                double target = 1.0 - rate * annuity;
+                double slope = 1.0 + rate * pillar.at_maturity;
+                double d;
+
+                // The bond's value rises from rate * annuity as D -> 0, so no positive discount
+                // factor prices it at par once the earlier coupons alone are worth par
+                if (!(target > 0.0))
+                    throw std::runtime_error("ParCurveBootstrapper: par rate " + std::to_string(rate)
+                        + " cannot be bootstrapped at pillar " + pillars_[k - 1].toStr()
+                        + "; coupons before it are already worth par");
+
+                if (pillar.inside.empty()) {
+                    d = target / slope;
+                }
+                else {
+                    double y_prev = y[k - 1];
+                    auto f = [&](double D) {
+                        double log_d = std::log(D);
+                        double sum = 0.0;
+                        for (const auto& c : pillar.inside) {
+                            sum += c.accrual * std::exp(y_prev + c.weight * (log_d - y_prev));
+                        }
+                        return rate * sum + slope * D - target;
+                        };
+
+                    // f(D) -> -target < 0 as D -> 0 and grows without bound, so both ends widen
+                    double lower = 1e-12;
+                    for (int i = 0; i < 16 && f(lower) > 0.0; ++i) lower *= 1e-6;
+                    double upper = 2.0 * std::max(1.0, std::exp(y_prev));
+                    for (int i = 0; i < 16 && f(upper) < 0.0; ++i) upper *= 2.0;
+                    if (f(lower) > 0.0 || f(upper) < 0.0)
+                        throw std::runtime_error("ParCurveBootstrapper: no discount factor brackets par rate "
+                            + std::to_string(rate) + " at pillar " + pillars_[k - 1].toStr());
+
+                    BrentSolver solver(100, 1e-15);
+                    d = solver.solve(f, lower, upper);
+                }
+
+                if (!(d > 0.0))
+                    throw std::runtime_error("ParCurveBootstrapper: non-positive discount factor at pillar "
+                        + pillars_[k - 1].toStr());
+
+                discounts[k - 1] = d;
+                y[k] = std::log(d);
+            }
+
+            return discounts;
+        }
+
+        /**
+         * @brief Bootstraps one curve.
+         */
+        InterpolatedCurve bootstrap(const std::vector<double>& par_rates) const {
+            return InterpolatedCurve(curve_layout_, discountFactors(par_rates), InterpolatedCurve::Interpolation::LogLinear);
+        }
+
+        /**
+         * @brief Bootstraps a curve per scenario in parallel.
+         *
+         * Scenarios are submitted in contiguous chunks so per-task overhead is amortised over
+         * many curves.
+         *
+         * @param scenarios Par rates per scenario, one per tenor.
+         * @param executor Executor for the chunks.
+         * @param chunk Scenarios per task.
+         * @return One curve per scenario, in scenario order; ready for MultiScenarioProjection.
+         */
+        std::vector<std::shared_ptr<YieldCurve>> bootstrap(
+            const std::vector<std::vector<double>>& scenarios,
+            TaskExecutor& executor,
+            size_t chunk = 64) const {
+            std::vector<std::shared_ptr<YieldCurve>> curves(scenarios.size());
+            std::vector<std::function<void()>> tasks;
+            chunk = std::max<size_t>(chunk, 1);
+
+            for (size_t begin = 0; begin < scenarios.size(); begin += chunk) {
+                size_t end = std::min(begin + chunk, scenarios.size());
+                tasks.push_back([this, begin, end, &scenarios, &curves]() {
+                    for (size_t i = begin; i < end; ++i) {
+                        curves[i] = std::make_shared<InterpolatedCurve>(bootstrap(scenarios[i]));
+                    }
+                    });
+            }
+
+            executor.submitAndWait(tasks);
+
+            return curves;
+        }
+
+    private:
+        // A coupon's position on the curve: log-linear between nodes segment and segment + 1
+        struct Coupon {
+            size_t segment;
+            double weight;
+            double accrual;
+        };
+
+        struct Pillar {
+            std::vector<Coupon> known;    // coupons on already solved segments
+            std::vector<Coupon> inside;   // coupons strictly inside the segment being solved
+            double at_maturity = 0.0;     // accrual of the coupon paid with the principal
+        };
+
+        Date ref_;
+        DayCounter dc_;
+        std::vector<Date> pillars_;
+        std::vector<Pillar> layout_;
+        std::shared_ptr<const InterpolatedCurve::Layout> curve_layout_;  // shared by every curve produced
+    };
+
+}
@@ -0,0 +1,116 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <array>
+#include <numbers>
+
+namespace ALM {
+
+    /**
+     * @brief Philox4x32-10 counter-based random number generator (Salmon et al., 2011).
+     *
+     * Maps a 128-bit counter and 64-bit key to 128 random bits with no state, so any draw can be
+     * computed directly from its coordinates. Giving each scenario its own counter range makes
+     * results independent of thread count, chunking and execution order.
+     */
+    class Philox4x32 {
+    public:
+        using Counter = std::array<uint32_t, 4>;
+
+        explicit Philox4x32(uint64_t key = 0)
+            : key_({ static_cast<uint32_t>(key), static_cast<uint32_t>(key >> 32) }) {
+        }
+
+        /// Random bits for a counter
+        Counter operator()(Counter counter) const {
+            std::array<uint32_t, 2> key = key_;
+            for (int round = 0; round < 10; ++round) {
+                if (round > 0) {
+                    key[0] += W0;
+                    key[1] += W1;
+                }
+                uint64_t p0 = static_cast<uint64_t>(M0) * counter[0];
+                uint64_t p1 = static_cast<uint64_t>(M1) * counter[2];
+                counter = {
+                    static_cast<uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+                    static_cast<uint32_t>(p1),
+                    static_cast<uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+                    static_cast<uint32_t>(p0)
+                };
+            }
+            return counter;
+        }
+
+        /**
+         * @brief Standard normal draws for one stream (e.g. a scenario).
+         *
+         * Draw i of a stream depends only on the key, stream and i. Each counter yields two
+         * 53-bit uniforms and, by Box-Muller, two normals.
+         *
+         * @param stream Stream identifier.
+         * @param first Index of the first draw; even indices avoid a discarded half block.
+         * @param out Destination for n draws.
+         */
+        void normals(uint64_t stream, uint64_t first, double* out, size_t n) const {
+            uint64_t index = first;
+            size_t written = 0;
+            while (written < n) {
+                uint64_t block = index / 2;
+                Counter bits = (*this)({
+                    static_cast<uint32_t>(block), static_cast<uint32_t>(block >> 32),
+                    static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32) });
+
+                double u1 = toUniform(bits[0], bits[1]);
+                double u2 = toUniform(bits[2], bits[3]);
+                double radius = std::sqrt(-2.0 * std::log(u1));
+                double angle = 2.0 * std::numbers::pi * u2;
+                double pair[2] = { radius * std::cos(angle), radius * std::sin(angle) };
+
+                for (size_t j = index % 2; j < 2 && written < n; ++j, ++index) {
+                    out[written++] = pair[j];
+                }
+            }
+        }
+
+        /// Uniform on (0, 1] from 53 random bits
+        static double toUniform(uint32_t hi, uint32_t lo) {
+            uint64_t bits = (static_cast<uint64_t>(hi) << 32 | lo) >> 11;
+            return (static_cast<double>(bits) + 1.0) * 0x1.0p-53;
+        }
+
+    private:
+        static constexpr uint32_t M0 = 0xD2511F53;
+        static constexpr uint32_t M1 = 0xCD9E8D57;
+        static constexpr uint32_t W0 = 0x9E3779B9;
+        static constexpr uint32_t W1 = 0xBB67AE85;
+
+        std::array<uint32_t, 2> key_;
+    };
+
+}
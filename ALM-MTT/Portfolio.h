@@ -28,6 +28,8 @@
 #include <vector>
 #include <atomic>
 #include <functional>
+#include <algorithm>
+#include <unordered_map>
 #include "TaskExecutor.h"
 #include "SingleThreadedExecutor.h"
 #include "Date.h"
@@ -41,6 +43,9 @@ namespace ALM {
      *
      * The portfolio provides methods for calculating market value and cash flows using a yield curve
      * and a task executor for parallel evaluation.
+     *
+     * Portfolio-wide volume changes (e.g. pro-rata sales) are held in a lazy scale factor that is
+     * applied to totals in O(1) and only folded into individual asset volumes when they are accessed.
      */
     class Portfolio {
     public:
@@ -57,9 +62,85 @@ namespace ALM {
          * @brief Add a new asset to the portfolio.
          */
         void addAsset(Asset asset) {
+            asset.setVolume(unscaled(asset.volume()));
             assets_.push_back(std::move(asset));
         }
 
+        /**
+         * @brief Add an asset to the lot with the given key, see Asset::merge.
+         *
+         * All assets added under one key are held as a single asset whose cash flows are summed
+         * date by date. Keying purchases of one instrument on one coupon date grid (e.g. the
+         * same coupon and tenor, bought on the same day of the coupon period) makes their flows
+         * fall on shared dates, so repeated reinvestment adds at most the new dates at the end
+         * of the lot instead of a new asset that every valuation has to scan.
+         */
+        void addLot(Asset asset, size_t key) {
+            auto [lot, added] = lots_.try_emplace(key, assets_.size());
+            if (added) {
+                addAsset(std::move(asset));
+                return;
+            }
+            assets_[lot->second].merge(asset, unscaled(asset.volume()));
+        }
+
+        /**
+         * @brief Drop assets whose last cash flow is before the reference date.
+         *
+         * Matured assets contribute nothing to marketValue or cashFlow on or after `ref`,
+         * so removing them keeps per-step cost bounded by the number of live positions.
+         *
+         * @param ref The current projection date.
+         * @return Number of assets removed.
+         */
+        size_t removeMatured(const Date& ref) {
+            if (std::none_of(assets_.begin(), assets_.end(), [&ref](const Asset& asset) { return asset.hasMatured(ref); }))
+                return 0;
+
+            // Compact in place, remembering where each live asset moved for the lot index
+            constexpr size_t gone = static_cast<size_t>(-1);
+            std::vector<size_t> moved(assets_.size(), gone);
+            size_t live = 0;
+            for (size_t i = 0; i < assets_.size(); ++i) {
+                if (assets_[i].hasMatured(ref)) continue;
+                if (live != i) assets_[live] = std::move(assets_[i]);
+                moved[i] = live++;
+            }
+
+            size_t removed = assets_.size() - live;
+            assets_.erase(assets_.begin() + live, assets_.end());
+
+            std::erase_if(lots_, [&moved](const auto& lot) { return moved[lot.second] == gone; });
+            for (auto& lot : lots_) {
+                lot.second = moved[lot.second];
+            }
+            return removed;
+        }
+
+        /**
+         * @brief Scale the volume of every asset by a common factor in O(1).
+         *
+         * @param factor Multiplier applied to all current volumes (e.g. 1 - fraction sold).
+         */
+        void scale(double factor) {
+            scale_ *= factor;
+        }
+
+        /// Number of assets held
+        size_t size() const {
+            return assets_.size();
+        }
+
+        /// The i-th asset; its volume() excludes any pending scale, see volume(i)
+        const Asset& asset(size_t i) const {
+            return assets_[i];
+        }
+
+        /// Volume of the i-th asset including any pending portfolio-wide scale
+        double volume(size_t i) const {
+            return assets_[i].volume() * scale_;
+        }
+
         /**
          * @brief Computes the total market value of the portfolio as of a given reference date.
          *
@@ -69,13 +150,38 @@ namespace ALM {
          * @return Present value of all assets in the portfolio.
          */
         double marketValue(const std::shared_ptr<const YieldCurve>& curve, const Date& ref) const {
-            std::atomic<double> total = 0.0;
+            return marketValue(*curve, ref);
+        }
+
+        /**
+         * @brief Market value against a curve of known type; see Asset::marketValue.
+         */
+        template <YieldCurveType Curve>
+        double marketValue(const Curve& curve, const Date& ref) const {
+            double total = 0.0;
 
             for (const auto& asset : assets_) {
                 total += asset.marketValue(curve, ref);
             }
 
-            return total;
+            return total * scale_;
+        }
+
+        /**
+         * @brief Computes the total cash flow from all assets over a date range on the calling thread.
+         *
+         * @param from Start date (exclusive).
+         * @param to End date (inclusive).
+         * @return Total cash flow generated by all assets in the range.
+         */
+        double cashFlow(const Date& from, const Date& to) const {
+            double total = 0.0;
+
+            for (const auto& asset : assets_) {
+                total += asset.cashFlow(from, to);
+            }
+
+            return total * scale_;
         }
 
         /**
@@ -86,7 +192,7 @@ namespace ALM {
          * @param executor Task executor for concurrent evaluation.
          * @return Total cash flow generated by all assets in the range.
          */
-        double cashFlow(const Date& from, const Date& to, const std::shared_ptr<TaskExecutor>& executor = std::make_shared<SingleThreadedExecutor>()) const {
+        double cashFlow(const Date& from, const Date& to, const std::shared_ptr<TaskExecutor>& executor) const {
             std::atomic<double> total = 0.0;
             std::vector<std::function<void()>> tasks;
 
@@ -97,18 +203,37 @@ namespace ALM {
             }
 
             executor->submitAndWait(tasks);
-            return total;
+            return total * scale_;
         }
 
         /**
          * @brief Access to the asset vector for iteration or mutation.
+         *
+         * Folds any pending portfolio-wide scale into the asset volumes first.
          */
         std::vector<Asset>& assets() {
+            applyScale();
             return assets_;
         }
 
     private:
         std::vector<Asset> assets_;
+        std::unordered_map<size_t, size_t> lots_;       ///< Lot key -> index into assets_, see addLot
+        double scale_ = 1.0;                            ///< Pending multiplier on every asset volume
+
+        void applyScale() {
+            if (scale_ == 1.0) return;
+            for (auto& asset : assets_) {
+                asset.setVolume(asset.volume() * scale_);
+            }
+            scale_ = 1.0;
+        }
+
+        // Convert an effective volume into the stored (pre-scale) volume
+        double unscaled(double volume) {
+            if (scale_ == 0.0) applyScale();  // fully liquidated book; cannot divide back out
+            return volume / scale_;
+        }
     };
 
 }
@@ -0,0 +1,197 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <mutex>
+#include "Date.h"
+#include "Portfolio.h"
+#include "YieldCurve.h"
+#include "RelinkableHandle.h"
+#include "Observable.h"
+
+namespace ALM {
+
+    /**
+     * @brief A portfolio's cash flows summed by payment date, rebuilt only when its handle is
+     *        relinked.
+     *
+     * Valuing the profile costs one discount factor per distinct payment date rather than one
+     * per asset cash flow, and cash flow over an interval is a difference of prefix sums. The
+     * profile does not depend on any curve, so curve relinks leave it untouched.
+     *
+     * Each rebuild publishes a new immutable Data; readers keep the one they obtained from
+     * data(), so a relink on another thread never changes vectors they are reading.
+     */
+    class CashFlowProfile : public LazyObject {
+    public:
+        struct Data {
+            std::vector<Date> dates;            ///< Distinct payment dates, ascending
+            std::vector<double> amounts;        ///< Volume-weighted amount paid on each date
+            std::vector<double> cumulative;     ///< cumulative[i] = sum of amounts[0, i)
+        };
+
+        explicit CashFlowProfile(std::shared_ptr<const RelinkableHandle<Portfolio>> portfolio)
+            : portfolio_(std::move(portfolio)) {
+            if (!portfolio_)
+                throw std::invalid_argument("CashFlowProfile: a portfolio handle is required");
+            registerWith(portfolio_->observable());
+        }
+
+        /// Profile of the portfolio currently linked
+        std::shared_ptr<const Data> data() const {
+            calculate();
+            std::lock_guard lock(data_mutex_);
+            return data_;
+        }
+
+        /**
+         * @brief Total cash flow in (from, to]; matches Portfolio::cashFlow.
+         */
+        double cashFlow(const Date& from, const Date& to) const {
+            std::shared_ptr<const Data> data = this->data();
+            const auto& dates = data->dates;
+            size_t lo = std::upper_bound(dates.begin(), dates.end(), from) - dates.begin();
+            size_t hi = std::upper_bound(dates.begin(), dates.end(), to) - dates.begin();
+            return hi > lo ? data->cumulative[hi] - data->cumulative[lo] : 0.0;
+        }
+
+    private:
+        void performCalculations() const override {
+            std::shared_ptr<const Portfolio> portfolio = portfolio_->get();
+
+            std::vector<std::pair<Date, double>> flows;
+            if (portfolio) {
+                for (size_t i = 0; i < portfolio->size(); ++i) {
+                    double volume = portfolio->volume(i);
+                    for (const auto& cf : portfolio->asset(i).cashFlows()) {
+                        flows.emplace_back(cf.date, cf.amount * volume);
+                    }
+                }
+            }
+            std::sort(flows.begin(), flows.end(),
+                [](const auto& a, const auto& b) { return a.first < b.first; });
+
+            auto data = std::make_shared<Data>();
+            for (const auto& [date, amount] : flows) {
+                if (!data->dates.empty() && data->dates.back() == date) {
+                    data->amounts.back() += amount;
+                }
+                else {
+                    data->dates.push_back(date);
+                    data->amounts.push_back(amount);
+                }
+            }
+
+            data->cumulative.assign(data->amounts.size() + 1, 0.0);
+            for (size_t i = 0; i < data->amounts.size(); ++i) {
+                data->cumulative[i + 1] = data->cumulative[i] + data->amounts[i];
+            }
+
+            std::lock_guard lock(data_mutex_);
+            data_ = std::move(data);
+        }
+
+        std::shared_ptr<const RelinkableHandle<Portfolio>> portfolio_;
+        mutable std::shared_ptr<const Data> data_;
+        mutable std::mutex data_mutex_;     ///< Guards the data_ pointer, not its contents
+    };
+
+    /**
+     * @brief Market value of a cash-flow profile on a relinkable curve, cached until either
+     *        changes.
+     *
+     * A curve relink recomputes only the discount factors on the profile's payment dates; the
+     * profile itself is reused. Several valuations may share one profile, e.g. liabilities on
+     * a base and a stressed curve, and relinking one curve leaves the others' caches valid.
+     * Like the profile, each recalculation publishes an immutable cache, so marketValue reads
+     * dates, discounted sums and curve from the same calculation.
+     */
+    class PortfolioValuation : public LazyObject {
+    public:
+        PortfolioValuation(
+            std::shared_ptr<CashFlowProfile> profile,
+            std::shared_ptr<const RelinkableHandle<YieldCurve>> curve)
+            : profile_(std::move(profile)), curve_(std::move(curve)) {
+            if (!profile_ || !curve_)
+                throw std::invalid_argument("PortfolioValuation: a profile and a curve handle are required");
+            registerWith(profile_);
+            registerWith(curve_->observable());
+        }
+
+        /**
+         * @brief Value of the flows dated on or after `ref`, discounted to `ref`; matches
+         *        Portfolio::marketValue on the handle's current curve.
+         */
+        double marketValue(const Date& ref) const {
+            calculate();
+            std::shared_ptr<const Cache> cache;
+            {
+                std::lock_guard lock(cache_mutex_);
+                cache = cache_;
+            }
+            const auto& dates = cache->profile->dates;
+            size_t first = std::lower_bound(dates.begin(), dates.end(), ref) - dates.begin();
+            return cache->suffix[first] / cache->curve->discount(ref);
+        }
+
+    private:
+        struct Cache {
+            std::shared_ptr<const CashFlowProfile::Data> profile;
+            std::shared_ptr<const YieldCurve> curve;    ///< Curve the cache was built on
+            std::vector<double> suffix;                 ///< suffix[i] = discounted value of flows i and later
+        };
+
+        void performCalculations() const override {
+            std::shared_ptr<const YieldCurve> curve = curve_->get();
+            if (!curve)
+                throw std::logic_error("PortfolioValuation: the curve handle is empty");
+
+            auto cache = std::make_shared<Cache>();
+            cache->profile = profile_->data();
+            const auto& dates = cache->profile->dates;
+            const auto& amounts = cache->profile->amounts;
+
+            cache->suffix.assign(dates.size() + 1, 0.0);
+            for (size_t i = dates.size(); i-- > 0;) {
+                cache->suffix[i] = cache->suffix[i + 1] + amounts[i] * curve->discount(dates[i]);
+            }
+            cache->curve = std::move(curve);
+
+            std::lock_guard lock(cache_mutex_);
+            cache_ = std::move(cache);
+        }
+
+        std::shared_ptr<CashFlowProfile> profile_;
+        std::shared_ptr<const RelinkableHandle<YieldCurve>> curve_;
+        mutable std::shared_ptr<const Cache> cache_;
+        mutable std::mutex cache_mutex_;    ///< Guards the cache_ pointer, not its contents
+    };
+
+}
@@ -23,10 +23,11 @@
 */
 
 #pragma once
-#include <Eigen/dense>
+#include <Eigen/Dense>
 #include "SolverXd.h"
 #include "Constraint.h"
-#include "UI.h"
+#include "Log.h"
+#include "Trace.h"
 
 namespace ALM {
 
@@ -52,6 +53,7 @@ namespace ALM {
             int n = x.size();
 
             for (int iter = 0; iter < max_iter_; ++iter) {
+                ALM_TRACE_SCOPE("solver", "ProjectedGradientSolver::iteration");
 
                 Eigen::VectorXd grad(n);
                 double eps = 1e-6;
@@ -76,7 +78,7 @@ namespace ALM {
                 }
 
                 fx = fx_new;
-                UI::debugPrint("Iteration " + std::to_string(iter) + ": " + std::to_string(fx));
+                ALM_LOG_DEBUG("Iteration {}: {}", iter, fx);
             }
 
             return { x, fx, max_iter_, false };
@@ -31,29 +31,17 @@
 #include "YieldCurve.h"
 #include "TaskExecutor.h"
 #include "Strategy.h"
+#include "ProjectionKernel.h"
 #include "UI.h"
 
 namespace ALM {
 
-    /**
-     * @brief Stores results of a projection over time.
-     *
-     * Tracks key metrics per time step: dates, asset/liability values, cash, and surplus.
-     */
-    struct ProjectionResult {
-        double scalar;
-        std::vector<Date> dates;
-        std::vector<double> assets_bop;
-        std::vector<double> liabilities_bop;
-        std::vector<double> cash_bop;
-        std::vector<double> surplus_bop;
-        double ending_surplus = 0.0;
-    };
-
     /**
      * @brief Runs a forward ALM projection with asset, liability, and strategy logic.
      *
      * Supports parallel pricing through a task executor and uses a strategy for reinvestment/disinvestment.
+     * This is the runtime-polymorphic front end of ProjectionKernel; curve and strategy calls go
+     * through virtual dispatch.
      */
     class Projection {
     public:
@@ -92,49 +80,25 @@ namespace ALM {
          * @return ProjectionResult containing time series and final surplus.
          */
         ProjectionResult run(double scalar = 1.0) {
-            ProjectionResult result;
-            result.scalar = scalar;
-
-            Portfolio portfolio = assets_;  // Copy assets to allow modification
-            for (auto& asset : portfolio.assets()) {
-                asset.setVolume(asset.volume() * scalar);
-            }
-
-            double cash = 0.0;
-            Date current = start_;
-            Date next = current + step_;
-
-            while (current < end_) {
-                // Record date
-                result.dates.push_back(current);
-
-                // Asset and liability valuation at beginning of period
-                double mv = portfolio.marketValue(curve_, current);
-                double liability_mv = liabilities_.marketValue(curve_, current);
-
-                result.assets_bop.push_back(mv);
-                result.liabilities_bop.push_back(liability_mv);
-                result.cash_bop.push_back(cash);
-                result.surplus_bop.push_back(mv + cash - liability_mv);
-
-                // Asset inflows and liability outflows
-                double asset_cf = portfolio.cashFlow(current, next);
-                double liability_cf = liabilities_.cashFlow(current, next);
-
-                cash += asset_cf - liability_cf;
-
-                // Apply strategy logic
-                if (strategy_) {
-                    strategy_->apply(portfolio, cash, current, next, curve_);
-                }
-
-                current = next;
-                next = current + step_;
-            }
+            ProjectionKernel<YieldCurve, DynamicStrategy> kernel(
+                assets_,
+                liabilities_,
+                DynamicStrategy(strategy_.get(), curve_),
+                *curve_,
+                start_,
+                end_,
+                step_);
+
+            kernel.setCancellation(cancellation_);
+            return kernel.run(scalar);
+        }
 
-            // Compute final surplus (BOP assets + ending cash - final liability BOP)
-            result.ending_surplus = result.assets_bop.back() + cash - result.liabilities_bop.back();
-            return result;
+        /**
+         * @brief Token checked at every projection step; run() throws OperationCancelled once it
+         *        fires, which also aborts a StartingAssetSolver solve over this projection.
+         */
+        void setCancellation(CancellationToken token) {
+            cancellation_ = std::move(token);
         }
 
     private:
@@ -145,6 +109,7 @@ namespace ALM {
         Date start_;
         Date end_;
         Duration step_;
+        CancellationToken cancellation_;
     };
 
 }
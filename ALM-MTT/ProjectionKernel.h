@@ -0,0 +1,213 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <vector>
+#include <memory>
+#include "Date.h"
+#include "Portfolio.h"
+#include "YieldCurve.h"
+#include "Strategy.h"
+#include "CancellationToken.h"
+#include "Trace.h"
+
+namespace ALM {
+
+    /**
+     * @brief Stores results of a projection over time.
+     *
+     * Tracks key metrics per time step: dates, asset/liability values, cash, and surplus.
+     */
+    struct ProjectionResult {
+        double scalar = 0.0;
+        std::vector<Date> dates;
+        std::vector<double> assets_bop;
+        std::vector<double> liabilities_bop;
+        std::vector<double> cash_bop;
+        std::vector<double> surplus_bop;
+        double ending_surplus = 0.0;
+    };
+
+    /**
+     * @brief Adapts an optional runtime Strategy to the kernel's strategy interface.
+     *
+     * The runtime interface takes the curve as a shared_ptr; the adapter holds it so the kernel
+     * can pass any curve type. For curves not owned by a shared_ptr (e.g. stack views), pass a
+     * non-owning pointer built with the shared_ptr aliasing constructor.
+     */
+    class DynamicStrategy {
+    public:
+        DynamicStrategy(Strategy* strategy, std::shared_ptr<const YieldCurve> curve)
+            : strategy_(strategy), curve_(std::move(curve)) {
+        }
+
+        template <YieldCurveType Curve>
+        void apply(Portfolio& portfolio, double& cash, StepContext& step, const Curve&) {
+            if (strategy_) {
+                strategy_->apply(portfolio, cash, step, curve_);
+            }
+        }
+
+    private:
+        Strategy* strategy_;
+        std::shared_ptr<const YieldCurve> curve_;
+    };
+
+    /**
+     * @brief Projection loop specialized at compile time on the curve and strategy types.
+     *
+     * With a concrete curve (e.g. FlatForward) and a statically composed strategy
+     * (e.g. Rebalance<SellProRata, BuyBonds>), discounting, day counting and the strategy step
+     * are all bound statically and can be inlined into the pricing loop. Projection is the
+     * type-erased front end over this kernel.
+     *
+     * The kernel references the portfolios and curve it is given, which must outlive it.
+     * The strategy is held by value, so each kernel owns its strategy state.
+     *
+     * @tparam Curve Curve type; YieldCurve itself gives virtual dispatch.
+     * @tparam StrategyT Type providing apply(Portfolio&, double&, StepContext&, const Curve&).
+     * @tparam Liabilities Read-only liability source providing marketValue(curve, date) and
+     *                     cashFlow(from, to), e.g. Portfolio or a mapped InforceFile.
+     */
+    template <YieldCurveType Curve, typename StrategyT, typename Liabilities = Portfolio>
+    class ProjectionKernel {
+    public:
+        ProjectionKernel(
+            const Portfolio& assets,
+            const Liabilities& liabilities,
+            StrategyT strategy,
+            const Curve& curve,
+            Date start,
+            Date end,
+            Duration step = Duration(1, Duration::Unit::Months))
+            : assets_(assets),
+            liabilities_(liabilities),
+            strategy_(std::move(strategy)),
+            curve_(curve),
+            start_(start),
+            end_(end),
+            step_(step) { }
+
+        /**
+         * @brief Runs the projection for a given initial asset scalar.
+         *
+         * @param scalar Multiplier to apply to starting asset volumes.
+         * @return ProjectionResult containing time series and final surplus.
+         * @throws OperationCancelled if the cancellation token fires; checked once per step.
+         */
+        ProjectionResult run(double scalar = 1.0) {
+            return run(scalar, [](const Date&, const Portfolio&, double) {});
+        }
+
+        /**
+         * @brief Runs the projection, showing the state at the start of every step to an observer.
+         *
+         * @param observe Called as observe(date, portfolio, cash) before each step's valuation,
+         *                e.g. to capture outer-path states for nested valuations.
+         */
+        template <typename Observer>
+        ProjectionResult run(double scalar, Observer&& observe) {
+            ALM_TRACE_SCOPE("projection", "ProjectionKernel::run");
+            ProjectionResult result;
+            result.scalar = scalar;
+
+            Portfolio portfolio = assets_;  // Copy assets to allow modification
+            portfolio.scale(scalar);
+
+            double cash = 0.0;
+            Date current = start_;
+            Date next = current + step_;
+
+            while (current < end_) {
+                ALM_TRACE_SCOPE("projection", "ProjectionKernel::step");
+                cancellation_.throwIfCancelled();
+
+                // Record date
+                result.dates.push_back(current);
+
+                // Bonds bought by the strategy run off; stop scanning them once fully paid
+                portfolio.removeMatured(current);
+                observe(current, static_cast<const Portfolio&>(portfolio), cash);
+
+                // Asset and liability valuation at beginning of period
+                double mv, liability_mv;
+                {
+                    ALM_TRACE_SCOPE("projection", "Portfolio::marketValue");
+                    mv = portfolio.marketValue(curve_, current);
+                    liability_mv = liabilities_.marketValue(curve_, current);
+                }
+
+                result.assets_bop.push_back(mv);
+                result.liabilities_bop.push_back(liability_mv);
+                result.cash_bop.push_back(cash);
+                result.surplus_bop.push_back(mv + cash - liability_mv);
+
+                // Asset inflows and liability outflows
+                double asset_cf, liability_cf;
+                {
+                    ALM_TRACE_SCOPE("projection", "Portfolio::cashFlow");
+                    asset_cf = portfolio.cashFlow(current, next);
+                    liability_cf = liabilities_.cashFlow(current, next);
+                }
+
+                cash += asset_cf - liability_cf;
+
+                // Apply strategy logic, reusing this step's valuations
+                StepContext step{ current, next, mv, liability_mv, asset_cf, liability_cf };
+                {
+                    ALM_TRACE_SCOPE("strategy", "Strategy::apply");
+                    strategy_.apply(portfolio, cash, step, curve_);
+                }
+
+                current = next;
+                next = current + step_;
+            }
+
+            // Compute final surplus (BOP assets + ending cash - final liability BOP)
+            result.ending_surplus = result.assets_bop.back() + cash - result.liabilities_bop.back();
+            return result;
+        }
+
+        StrategyT& strategy() {
+            return strategy_;
+        }
+
+        /// Token checked at every projection step; a solve over this kernel stops with it
+        void setCancellation(CancellationToken token) {
+            cancellation_ = std::move(token);
+        }
+
+    private:
+        const Portfolio& assets_;
+        const Liabilities& liabilities_;
+        StrategyT strategy_;
+        const Curve& curve_;
+        Date start_;
+        Date end_;
+        Duration step_;
+        CancellationToken cancellation_;
+    };
+
+}
@@ -0,0 +1,359 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include "BatchJob.h"
+#include "ThreadPoolExecutor.h"
+#include "CancellationToken.h"
+#include "Log.h"
+
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace ALM {
+
+    /**
+     * @brief Request latency of a service over its most recent requests.
+     */
+    struct LatencyStats {
+        size_t requests = 0;        ///< Requests answered since the service started
+        size_t errors = 0;          ///< Of which failed
+        size_t active = 0;          ///< Requests in progress
+        double p50 = 0.0;           ///< Seconds, over the last ProjectionService::LatencyWindow requests
+        double p99 = 0.0;
+        double max = 0.0;
+    };
+
+    /**
+     * @brief Resident projection service answering what-if jobs over a Unix domain socket.
+     *
+     * Inforce portfolios, scenario sets, scenario reductions and worst-first orders stay loaded
+     * between requests in a BatchRunner, so a request pays only for its projections. All clients
+     * share one ThreadPoolExecutor that rotates over their batches task by task, so a small
+     * what-if is not queued behind another client's full run; each client's connection thread
+     * also works on its own batch.
+     *
+     * The protocol is line based. A request is a job in JobFile syntax, where the `[job <name>]`
+     * header is optional, followed by a line `end`; the request `stats` reports latencies.
+     * Each job is answered by a line `ok <name> value=.. mean=.. completed=<n>/<of> seconds=..`,
+     * then one line `scenario <index> <starting assets> <ending surplus> <weight>` per scenario
+     * of a run job or for the scenario attaining a max job's maximum, or one line
+     * `volume <asset> <volume>` per asset of an optimize job; the response ends with `end`.
+     * A failed request is answered by `error <message>` and `end`.
+     *
+     * The response replaces the job's output files: a request may not set `results` or
+     * `summary`, which would have the server write wherever a client asks, nor `processes`,
+     * which would fork the multithreaded server, nor `threads`, as all clients share the
+     * service's pool. For example, with `nc -U <socket>`:
+     *
+     *     assets = assets.bin
+     *     liabilities = liabilities.bin
+     *     scenarios = scenarios.bin
+     *     start = 2025-12-31
+     *     horizon = 30Y
+     *     sell = 3, 7, 12
+     *     reduce = 50
+     *     end
+     */
+    class ProjectionService {
+    public:
+        static constexpr size_t LatencyWindow = 4096;
+
+        /**
+         * @param threads Size of the shared pool; 0 for the hardware concurrency.
+         */
+        explicit ProjectionService(size_t threads = 0)
+            : executor_(std::make_shared<ThreadPoolExecutor>(
+                threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency()),
+                ThreadPoolExecutor::Scheduling::RoundRobin)),
+            runner_(executor_) {
+        }
+
+        ProjectionService(const ProjectionService&) = delete;
+        ProjectionService& operator=(const ProjectionService&) = delete;
+
+        /**
+         * @brief Answers one request, without its terminating `end` line. Thread-safe.
+         * @return The response lines, ending with `end`.
+         */
+        std::string handle(const std::string& request) {
+            if (trimmed(request) == "stats") {
+                return statsLine(stats()) + "end\n";
+            }
+
+            auto t0 = std::chrono::steady_clock::now();
+            ++active_;
+            std::ostringstream response;
+            bool failed = false;
+            try {
+                std::string text = request.find("[job") == std::string::npos ? "[job request]\n" + request : request;
+                std::istringstream in(text);
+                std::vector<BatchJob> jobs = JobFile::parse(in, "request");
+                if (jobs.empty())
+                    throw std::runtime_error("empty request");
+                for (const BatchJob& job : jobs) {
+                    admit(job);
+                }
+
+                for (const BatchJob& job : jobs) {
+                    write(response, runner_.run(job));
+                }
+            }
+            catch (const std::exception& e) {
+                response.str("");
+                response << "error " << e.what() << "\n";
+                failed = true;
+            }
+            --active_;
+            record(std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count(), failed);
+
+            response << "end\n";
+            return response.str();
+        }
+
+        /// Latency percentiles over the most recent requests
+        LatencyStats stats() const {
+            std::vector<double> window;
+            LatencyStats stats;
+            {
+                std::lock_guard lock(stats_mutex_);
+                window = latencies_;
+                stats.requests = requests_;
+                stats.errors = errors_;
+            }
+            stats.active = active_.load();
+            if (window.empty()) return stats;
+
+            std::sort(window.begin(), window.end());
+            auto at = [&window](double q) {
+                return window[std::min(window.size() - 1, static_cast<size_t>(q * static_cast<double>(window.size())))];
+                };
+            stats.p50 = at(0.50);
+            stats.p99 = at(0.99);
+            stats.max = window.back();
+            return stats;
+        }
+
+        /**
+         * @brief Listens on a Unix domain socket until the token fires, serving each client on
+         *        its own thread. A stale socket file at the path is replaced.
+         * @throws std::runtime_error if the socket cannot be created, or on platforms without
+         *         Unix domain sockets.
+         */
+        void serve(const std::string& path, const CancellationToken& stop) {
+#ifdef _WIN32
+            (void)path;
+            (void)stop;
+            throw std::runtime_error("ProjectionService: Unix domain sockets are not supported on this platform");
+#else
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            if (path.empty() || path.size() >= sizeof(address.sun_path))
+                throw std::runtime_error("ProjectionService: invalid socket path " + path);
+            std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+            struct stat existing;
+            if (::stat(path.c_str(), &existing) == 0) {
+                if (!S_ISSOCK(existing.st_mode))
+                    throw std::runtime_error("ProjectionService: " + path + " exists and is not a socket");
+                ::unlink(path.c_str());
+            }
+
+            int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (listener < 0)
+                throw std::runtime_error("ProjectionService: cannot create socket");
+            if (::bind(listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0
+                || ::listen(listener, 64) != 0) {
+                ::close(listener);
+                throw std::runtime_error("ProjectionService: cannot listen on " + path);
+            }
+            ALM_LOG_INFO("listening on {}", path);
+
+            std::vector<Client> clients;
+            while (!stop.cancelled()) {
+                pollfd ready{ listener, POLLIN, 0 };
+                if (::poll(&ready, 1, 200) <= 0) continue;
+
+                int fd = ::accept(listener, nullptr, nullptr);
+                if (fd < 0) continue;
+
+                std::erase_if(clients, [](Client& client) {
+                    if (!client.done->load()) return false;
+                    client.thread.join();
+                    ::close(client.fd);
+                    return true;
+                    });
+
+                auto done = std::make_shared<std::atomic<bool>>(false);
+                clients.push_back({ fd, done, std::thread([this, fd, done]() {
+                    converse(fd);
+                    done->store(true);
+                    }) });
+            }
+
+            ::close(listener);
+            ::unlink(path.c_str());
+
+            // Unblock clients waiting for input; requests in progress finish first
+            for (Client& client : clients) {
+                if (!client.done->load()) ::shutdown(client.fd, SHUT_RD);
+            }
+            for (Client& client : clients) {
+                client.thread.join();
+                ::close(client.fd);
+            }
+#endif
+        }
+
+    private:
+        std::shared_ptr<ThreadPoolExecutor> executor_;
+        BatchRunner runner_;
+
+        mutable std::mutex stats_mutex_;
+        std::vector<double> latencies_;     // Ring of the last LatencyWindow request times
+        size_t next_latency_ = 0;
+        size_t requests_ = 0;
+        size_t errors_ = 0;
+        std::atomic<size_t> active_{ 0 };
+
+        struct Client {
+            int fd;
+            std::shared_ptr<std::atomic<bool>> done;
+            std::thread thread;
+        };
+
+        void record(double seconds, bool failed) {
+            std::lock_guard lock(stats_mutex_);
+            if (latencies_.size() < LatencyWindow) {
+                latencies_.push_back(seconds);
+            }
+            else {
+                latencies_[next_latency_] = seconds;
+                next_latency_ = (next_latency_ + 1) % LatencyWindow;
+            }
+            ++requests_;
+            if (failed) ++errors_;
+        }
+
+        // Rejects the keys a client may not set; see the class description
+        static void admit(const BatchJob& job) {
+            auto refuse = [&job](const char* key, const char* reason) {
+                throw std::runtime_error("job " + job.name + ": " + key + " is not accepted by the service; " + reason);
+                };
+            if (!job.results.empty()) refuse("results", "the response carries the values");
+            if (!job.summary.empty()) refuse("summary", "the response carries the values");
+            if (job.processes > 1) refuse("processes", "jobs run in the service's process");
+            if (job.threads != 0) refuse("threads", "jobs share the service's pool");
+        }
+
+        static void write(std::ostream& out, const BatchOutcome& outcome) {
+            out << std::setprecision(17) << "ok " << outcome.name
+                << " value=" << outcome.value << " mean=" << outcome.mean
+                << " completed=" << outcome.completed << "/" << outcome.scenarios
+                << " seconds=" << std::setprecision(6) << outcome.seconds << "\n" << std::setprecision(17);
+            for (const ScenarioValue& value : outcome.details) {
+                out << "scenario " << value.scenario << ' ' << value.starting_assets << ' '
+                    << value.ending_surplus << ' ' << value.weight << "\n";
+            }
+            for (size_t i = 0; i < outcome.volumes.size(); ++i) {
+                out << "volume " << i << ' ' << outcome.volumes[i] << "\n";
+            }
+        }
+
+        static std::string statsLine(const LatencyStats& stats) {
+            std::ostringstream line;
+            line << std::fixed << std::setprecision(3) << "ok stats requests=" << stats.requests
+                << " errors=" << stats.errors << " active=" << stats.active
+                << " p50_ms=" << 1e3 * stats.p50 << " p99_ms=" << 1e3 * stats.p99
+                << " max_ms=" << 1e3 * stats.max << "\n";
+            return line.str();
+        }
+
+        static std::string trimmed(const std::string& text) {
+            size_t first = text.find_first_not_of(" \t\r\n");
+            if (first == std::string::npos) return "";
+            size_t last = text.find_last_not_of(" \t\r\n");
+            return text.substr(first, last - first + 1);
+        }
+
+#ifndef _WIN32
+        // Reads requests until the client disconnects, answering each as it completes; the
+        // accepting thread closes the descriptor
+        void converse(int fd) {
+            std::string pending, request;
+            char buffer[4096];
+            while (true) {
+                ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+                if (n <= 0) break;
+                pending.append(buffer, static_cast<size_t>(n));
+
+                for (size_t eol; (eol = pending.find('\n')) != std::string::npos;) {
+                    std::string line = pending.substr(0, eol);
+                    pending.erase(0, eol + 1);
+                    if (trimmed(line) != "end") {
+                        request += line + "\n";
+                        continue;
+                    }
+                    if (!send(fd, handle(request))) return;
+                    request.clear();
+                }
+            }
+        }
+
+        static bool send(int fd, const std::string& text) {
+#ifdef MSG_NOSIGNAL
+            const int flags = MSG_NOSIGNAL;
+#else
+            const int flags = 0;
+#endif
+            for (size_t sent = 0; sent < text.size();) {
+                ssize_t n = ::send(fd, text.data() + sent, text.size() - sent, flags);
+                if (n <= 0) return false;
+                sent += static_cast<size_t>(n);
+            }
+            return true;
+        }
+#endif
+    };
+
+}
@@ -0,0 +1,102 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <memory>
+#include "Portfolio.h"
+#include "Strategy.h"
+#include "Date.h"
+#include "YieldCurve.h"
+
+namespace ALM {
+
+    /**
+     * @brief Statically composed counterpart of RebalanceStrategy.
+     *
+     * Holds the sell and buy strategies by value, so the branch and both component calls are
+     * bound at compile time and can be inlined, e.g. Rebalance<SellProRata, BuyBonds>. The
+     * composite is itself a Strategy and can be used anywhere a runtime strategy is expected,
+     * or passed to ProjectionKernel to inline the whole step against a concrete curve type.
+     *
+     * Thread safety: the components are owned by value, so each clone() is an independent copy
+     * and any state the components keep is per-scenario. Sell and Buy must be copyable.
+     *
+     * @tparam Sell Strategy to apply when cash is negative.
+     * @tparam Buy Strategy to apply when cash is positive or zero.
+     */
+    template <typename Sell, typename Buy>
+    class Rebalance final : public Strategy {
+
+    public:
+        Rebalance(Sell sell, Buy buy)
+            : sell_(std::move(sell)), buy_(std::move(buy)) {
+        }
+
+        /**
+         * @brief Applies either the sell or buy strategy based on current cash.
+         */
+        void apply(
+            Portfolio& portfolio,
+            double& cash,
+            StepContext& step,
+            const std::shared_ptr<const YieldCurve>& curve) override
+        {
+            apply(portfolio, cash, step, *curve);
+        }
+
+        /**
+         * @brief Statically dispatched form used by ProjectionKernel; Sell and Buy must provide it too.
+         */
+        template <YieldCurveType Curve>
+        void apply(
+            Portfolio& portfolio,
+            double& cash,
+            StepContext& step,
+            const Curve& curve)
+        {
+            if (cash < 0.0) {
+                sell_.apply(portfolio, cash, step, curve);
+            }
+            else {
+                buy_.apply(portfolio, cash, step, curve);
+            }
+        }
+
+        /**
+         * @brief Returns an independent copy of both components.
+         */
+        std::shared_ptr<Strategy> clone() const override {
+            return std::make_shared<Rebalance>(*this);
+        }
+
+        Sell& sell() { return sell_; }
+        Buy& buy() { return buy_; }
+
+    private:
+        Sell sell_; ///< Strategy to apply when cash < 0
+        Buy buy_;   ///< Strategy to apply when cash >= 0
+    };
+
+}
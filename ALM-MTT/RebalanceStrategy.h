@@ -58,18 +58,31 @@ namespace ALM {
         void apply(
             Portfolio& portfolio,
             double& cash,
-            Date step_start,
-            Date step_end,
+            StepContext& step,
             const std::shared_ptr<const YieldCurve>& curve) override
         {
             if (cash < 0.0) {
-                sell_->apply(portfolio, cash, step_start, step_end, curve);
+                sell_->apply(portfolio, cash, step, curve);
             }
             else {
-                buy_->apply(portfolio, cash, step_start, step_end, curve);
+                buy_->apply(portfolio, cash, step, curve);
             }
         }
 
+        /**
+         * @brief Clones the composite if either component carries per-scenario state.
+         */
+        std::shared_ptr<Strategy> clone() const override {
+            auto sell = sell_->clone();
+            auto buy = buy_->clone();
+            if (!sell && !buy)
+                return nullptr;
+
+            return std::make_shared<RebalanceStrategy>(
+                sell ? std::move(sell) : sell_,
+                buy ? std::move(buy) : buy_);
+        }
+
     private:
         std::shared_ptr<Strategy> sell_; ///< Strategy to apply when cash < 0
         std::shared_ptr<Strategy> buy_;  ///< Strategy to apply when cash >= 0
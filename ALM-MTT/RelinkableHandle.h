@@ -24,8 +24,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
-#include <shared_mutex>
+#include <mutex>
+#include <vector>
+#include "Observable.h"
 
 namespace ALM {
 
@@ -34,6 +38,18 @@ namespace ALM {
      *
      * This class wraps a std::shared_ptr<const T> and allows concurrent reads with safe relinking.
      * It is useful for scenarios like referencing yield curves across projections where updates may occur infrequently.
+     *
+     * The read path (operator*, operator->, isEmpty) is a single acquire load of the current
+     * pointer with no locking, so readers on many cores never contend; only the first such read
+     * after a relink writes, to mark the target as read. A relink publishes the new target and
+     * releases the previous one if it was never read that way, since references from get() keep
+     * it alive by themselves. A target that was read is retired instead, as readers may still be
+     * using it; retired targets are released by reclaim() once no reader can hold them (e.g.
+     * between projection batches) or when the handle is destroyed. Writers and get() serialize
+     * on a mutex.
+     *
+     * Each handle is an independent link: observers registered with observable() are notified
+     * after every relink of this handle, not of copies made from it.
      */
     template <typename T>
     class RelinkableHandle {
@@ -42,58 +58,122 @@ namespace ALM {
 
         // Construct from an existing shared_ptr
         explicit RelinkableHandle(std::shared_ptr<const T> ptr)
-            : ptr_(std::move(ptr)) {
+            : owner_(std::move(ptr)), current_(link(owner_.get())) {
         }
 
-        // Copy constructor (locks shared access)
+        // Copy constructor; the copy shares the current target but none of the retired ones
         RelinkableHandle(const RelinkableHandle& other) {
-            std::shared_lock lock(other.mutex_);
-            ptr_ = other.ptr_;
+            std::lock_guard lock(other.mutex_);
+            owner_ = other.owner_;
+            current_.store(link(owner_.get()), std::memory_order_release);
         }
 
-        // Copy assignment (thread-safe with lock ordering)
+        // Copy assignment; this handle's previous target is retired
         RelinkableHandle& operator=(const RelinkableHandle& other) {
             if (this != &other) {
-                std::unique_lock lhs_lock(mutex_, std::defer_lock);
-                std::shared_lock rhs_lock(other.mutex_, std::defer_lock);
-                std::lock(lhs_lock, rhs_lock);
-                ptr_ = other.ptr_;
+                {
+                    std::scoped_lock lock(mutex_, other.mutex_);
+                    publish(other.owner_);
+                }
+                observable_->notifyObservers();
             }
             return *this;
         }
 
         // Dereference access
         const T& operator*() const {
-            std::shared_lock lock(mutex_);
-            return *ptr_;
+            return *read();
         }
 
         const T* operator->() const {
-            std::shared_lock lock(mutex_);
-            return ptr_.get();
+            return read();
         }
 
-        // Access the internal shared_ptr
+        // Access the internal shared_ptr; takes the writer lock, so keep it off hot paths
         std::shared_ptr<const T> get() const {
-            std::shared_lock lock(mutex_);
-            return ptr_;
+            std::lock_guard lock(mutex_);
+            return owner_;
         }
 
         // Replace the stored pointer (thread-safe write)
         void reset(std::shared_ptr<const T> new_ptr) {
-            std::unique_lock lock(mutex_);
-            ptr_ = std::move(new_ptr);
+            {
+                std::lock_guard lock(mutex_);
+                publish(std::move(new_ptr));
+            }
+            observable_->notifyObservers();
+        }
+
+        /// Notifies its observers after each relink, e.g. to invalidate values cached on the target
+        const std::shared_ptr<Observable>& observable() const {
+            return observable_;
+        }
+
+        /**
+         * @brief Releases targets retired by earlier relinks.
+         *
+         * Call only once no thread can still use a reference or pointer read before the latest
+         * relink; references obtained through get() stay valid regardless.
+         * @return The number of targets released.
+         */
+        size_t reclaim() {
+            std::vector<std::shared_ptr<const T>> released;
+            {
+                std::lock_guard lock(mutex_);
+                released.swap(retired_);
+            }
+            return released.size();
+        }
+
+        /// Number of targets retired and not yet reclaimed
+        size_t retired() const {
+            std::lock_guard lock(mutex_);
+            return retired_.size();
         }
 
         // Check whether the handle currently points to anything
         bool isEmpty() const {
-            std::shared_lock lock(mutex_);
-            return !ptr_;
+            return (current_.load(std::memory_order_acquire) & ~Read) == 0;
         }
 
     private:
-        std::shared_ptr<const T> ptr_;
-        mutable std::shared_mutex mutex_;
+        static_assert(std::atomic<uintptr_t>::is_always_lock_free);
+        static_assert(alignof(T) >= 2, "RelinkableHandle: the low pointer bit marks a read target");
+
+        static constexpr uintptr_t Read = 1;    // Set in current_ once the target has been dereferenced
+
+        static uintptr_t link(const T* target) {
+            return reinterpret_cast<uintptr_t>(target);
+        }
+
+        const T* read() const {
+            uintptr_t current = current_.load(std::memory_order_acquire);
+            if (current & Read) [[likely]] return reinterpret_cast<const T*>(current & ~Read);
+            return mark(current);
+        }
+
+        // Marks the target as read before using it; if a relink replaced it meanwhile, the
+        // mark fails and the new target is read instead, so no released target is ever used
+        const T* mark(uintptr_t current) const {
+            while (current != 0 && !(current & Read)) {
+                if (current_.compare_exchange_weak(current, current | Read, std::memory_order_acq_rel, std::memory_order_acquire))
+                    break;
+            }
+            return reinterpret_cast<const T*>(current & ~Read);
+        }
+
+        // Caller holds mutex_
+        void publish(std::shared_ptr<const T> target) {
+            uintptr_t previous = current_.exchange(link(target.get()), std::memory_order_acq_rel);
+            if (owner_ && (previous & Read)) retired_.push_back(std::move(owner_));
+            owner_ = std::move(target);
+        }
+
+        std::shared_ptr<const T> owner_;
+        std::vector<std::shared_ptr<const T>> retired_;
+        mutable std::atomic<uintptr_t> current_{ 0 };
+        mutable std::mutex mutex_;
+        std::shared_ptr<Observable> observable_ = std::make_shared<Observable>();
     };
 
 }
@@ -0,0 +1,525 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <span>
+#include <array>
+#include <memory>
+#include <optional>
+#include <algorithm>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include "Date.h"
+#include "ProjectionKernel.h"
+#include "BoundedQueue.h"
+#include "MappedFile.h"
+
+namespace ALM {
+
+    /**
+     * @brief Fixed 64-byte header of a binary projection result file.
+     *
+     * The file holds ProjectionResult histories that share one date grid, in chunks of up to a
+     * few megabytes written in completion order. Each chunk of n results stores its columns back
+     * to back, every one starting at an 8-byte aligned offset:
+     * - scenarios: uint64_t[n], scenario index of each result
+     * - scalar, ending_surplus: double[n] each
+     * - assets_bop, liabilities_bop, cash_bop, surplus_bop: double[n][step_count] each
+     *
+     * After the last chunk come the date grid (int32_t[step_count] Date serials) and the chunk
+     * directory (ResultChunk[chunk_count]). The header is written last, so a file whose writer
+     * did not finish is rejected. Native byte order.
+     */
+    struct ResultHeader {
+        char magic[8];              ///< "ALMRES\0\0"
+        uint32_t version;           ///< Format version, see ResultFile::Version
+        uint32_t byte_order;        ///< 0x01020304 in the writer's byte order
+        uint64_t result_count;      ///< Results across all chunks
+        uint32_t step_count;        ///< Dates per result
+        uint32_t chunk_count;
+        uint64_t dates_offset;      ///< Byte offset of int32_t[step_count]
+        uint64_t chunks_offset;     ///< Byte offset of ResultChunk[chunk_count]
+        uint64_t reserved[2];
+    };
+
+    static_assert(sizeof(ResultHeader) == 64, "ResultHeader layout is part of the file format");
+
+    /// Directory entry of one chunk
+    struct ResultChunk {
+        uint64_t offset;            ///< Byte offset of the chunk's scenarios column
+        uint64_t count;             ///< Results in the chunk
+    };
+
+    /**
+     * @brief Zero-copy view of one stored result; the spans point into the mapped file.
+     */
+    struct ResultRecord {
+        size_t scenario = 0;
+        double scalar = 0.0;
+        double ending_surplus = 0.0;
+        std::span<const double> assets_bop;
+        std::span<const double> liabilities_bop;
+        std::span<const double> cash_bop;
+        std::span<const double> surplus_bop;
+    };
+
+    /**
+     * @brief Memory-mapped, read-only view of a result file written by ResultWriter.
+     *
+     * Opening validates the header and chunk directory; the series are never parsed or copied.
+     * Records are numbered in file order, which is the order scenarios completed; find() maps a
+     * scenario index to its record.
+     */
+    class ResultFile {
+    public:
+        static constexpr uint32_t Version = 1;
+        static constexpr char Magic[8] = { 'A', 'L', 'M', 'R', 'E', 'S', '\0', '\0' };
+        static constexpr uint32_t ByteOrder = 0x01020304;
+
+        /**
+         * @brief Map and validate a result file.
+         * @throws std::runtime_error if the file is missing, truncated, incomplete, or not a
+         *         supported version.
+         */
+        explicit ResultFile(const std::string& path)
+            : file_(path) {
+            if (file_.size() < sizeof(ResultHeader))
+                throw std::runtime_error("ResultFile: truncated header in " + path);
+
+            std::memcpy(&header_, file_.data(), sizeof(ResultHeader));
+
+            if (std::memcmp(header_.magic, Magic, sizeof(Magic)) != 0)
+                throw std::runtime_error("ResultFile: not a complete result file " + path);
+            if (header_.version != Version)
+                throw std::runtime_error("ResultFile: unsupported version " + std::to_string(header_.version) + " in " + path);
+            if (header_.byte_order != ByteOrder)
+                throw std::runtime_error("ResultFile: byte order mismatch in " + path);
+
+            serials_ = column<int32_t>(header_.dates_offset, header_.step_count, path);
+            chunks_ = column<ResultChunk>(header_.chunks_offset, header_.chunk_count, path);
+
+            uint64_t total = 0;
+            starts_.reserve(chunks_.size() + 1);
+            starts_.push_back(0);
+            size_t words = columnCount(stepCount());
+            for (const ResultChunk& chunk : chunks_) {
+                // The count is bounded before it is multiplied, so a corrupt count cannot wrap
+                if (chunk.offset > file_.size()
+                    || chunk.count > (file_.size() - chunk.offset) / (words * sizeof(uint64_t)))
+                    throw std::runtime_error("ResultFile: chunk out of bounds in " + path);
+                // Bounds-checks all seven columns of the chunk at once
+                column<uint64_t>(chunk.offset, static_cast<size_t>(chunk.count) * words, path);
+                total += chunk.count;
+                starts_.push_back(static_cast<size_t>(total));
+            }
+            if (total != header_.result_count)
+                throw std::runtime_error("ResultFile: inconsistent chunk directory in " + path);
+
+            index_.reserve(size());
+            for (size_t k = 0; k < size(); ++k) {
+                index_.emplace_back(static_cast<size_t>(scenarioAt(k)), k);
+            }
+            std::sort(index_.begin(), index_.end());
+        }
+
+        /// Number of stored results
+        size_t size() const { return static_cast<size_t>(header_.result_count); }
+
+        /// Dates per result
+        size_t stepCount() const { return header_.step_count; }
+
+        /// Date grid shared by all results, as Date serials
+        std::span<const int32_t> serials() const { return serials_; }
+
+        std::vector<Date> dates() const {
+            return std::vector<Date>(serials_.begin(), serials_.end());
+        }
+
+        /// The k-th record in file order
+        ResultRecord record(size_t k) const {
+            auto [chunk, slot] = locate(k);
+            size_t n = static_cast<size_t>(chunk.count);
+            size_t steps = stepCount();
+            const double* values = reinterpret_cast<const double*>(file_.data() + chunk.offset) + n;
+            const double* series = values + 2 * n + slot * steps;
+
+            ResultRecord record;
+            record.scenario = static_cast<size_t>(scenarioAt(k));
+            record.scalar = values[slot];
+            record.ending_surplus = values[n + slot];
+            record.assets_bop = { series, steps };
+            record.liabilities_bop = { series + n * steps, steps };
+            record.cash_bop = { series + 2 * n * steps, steps };
+            record.surplus_bop = { series + 3 * n * steps, steps };
+            return record;
+        }
+
+        /// Record position of a scenario, if the file holds it
+        std::optional<size_t> find(size_t scenario) const {
+            auto it = std::lower_bound(index_.begin(), index_.end(), std::pair<size_t, size_t>(scenario, 0));
+            if (it == index_.end() || it->first != scenario) return std::nullopt;
+            return it->second;
+        }
+
+        /// Copy the k-th record out of the mapping
+        ProjectionResult result(size_t k) const {
+            ResultRecord view = record(k);
+            ProjectionResult result;
+            result.scalar = view.scalar;
+            result.dates = dates();
+            result.assets_bop.assign(view.assets_bop.begin(), view.assets_bop.end());
+            result.liabilities_bop.assign(view.liabilities_bop.begin(), view.liabilities_bop.end());
+            result.cash_bop.assign(view.cash_bop.begin(), view.cash_bop.end());
+            result.surplus_bop.assign(view.surplus_bop.begin(), view.surplus_bop.end());
+            result.ending_surplus = view.ending_surplus;
+            return result;
+        }
+
+        /// Eight-byte words per result: scenario, scalar, ending surplus and four series
+        static size_t columnCount(size_t steps) {
+            return 3 + 4 * steps;
+        }
+
+    private:
+        MappedFile file_;
+        ResultHeader header_;
+        std::span<const int32_t> serials_;
+        std::span<const ResultChunk> chunks_;
+        std::vector<size_t> starts_;                        // First record of each chunk
+        std::vector<std::pair<size_t, size_t>> index_;      // (scenario, record), sorted
+
+        std::pair<const ResultChunk&, size_t> locate(size_t k) const {
+            if (k >= size())
+                throw std::out_of_range("ResultFile: record out of range");
+            size_t c = static_cast<size_t>(std::upper_bound(starts_.begin(), starts_.end(), k) - starts_.begin()) - 1;
+            return { chunks_[c], k - starts_[c] };
+        }
+
+        uint64_t scenarioAt(size_t k) const {
+            auto [chunk, slot] = locate(k);
+            uint64_t scenario;
+            std::memcpy(&scenario, file_.data() + chunk.offset + slot * sizeof(uint64_t), sizeof(scenario));
+            return scenario;
+        }
+
+        template <typename T>
+        std::span<const T> column(uint64_t offset, size_t count, const std::string& path) const {
+            if (offset % alignof(T) != 0 || offset > file_.size()
+                || count > (file_.size() - offset) / sizeof(T))
+                throw std::runtime_error("ResultFile: column out of bounds in " + path);
+
+            return { reinterpret_cast<const T*>(file_.data() + offset), count };
+        }
+    };
+
+    /**
+     * @brief Streams projection results to a ResultFile while they are being computed.
+     *
+     * append() may be called from any number of threads. Each thread fills its own chunk
+     * buffer without locking; full chunks are handed through a bounded queue to a writer
+     * thread that writes every column with one large sequential write. Output therefore
+     * overlaps with the projections, and memory is bounded by one chunk per appending thread
+     * plus the queue, however many scenarios are written.
+     *
+     * close() must not race with append(); call it once the batch has finished, e.g. after
+     * MultiScenarioProjection::run(writer) returns. The destructor closes but swallows errors.
+     */
+    class ResultWriter {
+    public:
+        static constexpr size_t DefaultChunkBytes = size_t(4) << 20;
+
+        /**
+         * @brief Create the file and start the writer thread.
+         *
+         * @param path Output file, truncated.
+         * @param chunk_bytes Target size of one chunk; at least one result per chunk.
+         * @param queue_capacity Full chunks that may wait for the writer before append() blocks.
+         * @throws std::runtime_error if the file cannot be created.
+         */
+        explicit ResultWriter(const std::string& path, size_t chunk_bytes = DefaultChunkBytes, size_t queue_capacity = 4)
+            : path_(path), chunk_bytes_(chunk_bytes), queue_(queue_capacity) {
+            out_.open(path, std::ios::binary | std::ios::trunc);
+            if (!out_)
+                throw std::runtime_error("ResultWriter: cannot open " + path);
+
+            // Zero magic until close() marks the file complete
+            ResultHeader placeholder{};
+            write(placeholder);
+            offset_ = sizeof(ResultHeader);
+
+            thread_ = std::thread([this]() { writeLoop(); });
+        }
+
+        ~ResultWriter() {
+            try {
+                close();
+            }
+            catch (...) {
+            }
+        }
+
+        ResultWriter(const ResultWriter&) = delete;
+        ResultWriter& operator=(const ResultWriter&) = delete;
+
+        /**
+         * @brief Queue one scenario's result. Empty results (unfinished scenarios) are skipped.
+         *
+         * @throws std::invalid_argument if the result's date grid differs in length from the
+         *         first result written.
+         * @throws std::runtime_error if the writer is closed or a previous write failed.
+         */
+        void append(size_t scenario, const ProjectionResult& result) {
+            if (result.dates.empty()) return;
+            if (closed_.load(std::memory_order_relaxed) || failed_.load(std::memory_order_relaxed))
+                throw std::runtime_error("ResultWriter: cannot append to " + path_);
+
+            Local& local = this->local();
+            if (!local.chunk) {
+                local.chunk = newChunk(result);
+            }
+            Chunk& chunk = *local.chunk;
+            size_t steps = chunk.steps;
+            if (result.dates.size() != steps || result.assets_bop.size() != steps
+                || result.liabilities_bop.size() != steps || result.cash_bop.size() != steps
+                || result.surplus_bop.size() != steps)
+                throw std::invalid_argument("ResultWriter: result does not match the date grid of " + path_);
+
+            size_t n = chunk.capacity;
+            size_t slot = chunk.count++;
+            chunk.scenarios[slot] = scenario;
+            double* values = chunk.values.data();
+            values[slot] = result.scalar;
+            values[n + slot] = result.ending_surplus;
+            double* series = values + 2 * n + slot * steps;
+            std::copy(result.assets_bop.begin(), result.assets_bop.end(), series);
+            std::copy(result.liabilities_bop.begin(), result.liabilities_bop.end(), series + n * steps);
+            std::copy(result.cash_bop.begin(), result.cash_bop.end(), series + 2 * n * steps);
+            std::copy(result.surplus_bop.begin(), result.surplus_bop.end(), series + 3 * n * steps);
+            appended_.fetch_add(1, std::memory_order_relaxed);
+
+            if (chunk.count == chunk.capacity) {
+                queue_.push(std::move(local.chunk));
+            }
+        }
+
+        /// Results appended so far
+        size_t size() const {
+            return appended_.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Flush all partial chunks, write the date grid, directory and header, and
+         *        close the file. Further calls do nothing.
+         * @throws std::runtime_error if any write failed.
+         */
+        void close() {
+            if (closed_.exchange(true)) return;
+
+            for (auto& local : locals_) {
+                if (local->chunk && local->chunk->count > 0) {
+                    queue_.push(std::move(local->chunk));
+                }
+            }
+            queue_.close();
+            thread_.join();
+
+            if (!error_) {
+                try {
+                    finish();
+                }
+                catch (...) {
+                    error_ = std::current_exception();
+                }
+            }
+            out_.close();
+            if (error_) std::rethrow_exception(error_);
+        }
+
+    private:
+        /// Up to `capacity` results laid out as the file's chunk columns
+        struct Chunk {
+            size_t capacity = 0;
+            size_t steps = 0;
+            size_t count = 0;
+            std::vector<uint64_t> scenarios;
+            std::vector<double> values;     // scalar, ending surplus, then the four series
+        };
+
+        /// One appending thread's open chunk
+        struct Local {
+            std::unique_ptr<Chunk> chunk;
+        };
+
+        /// A thread's recently used writers; ids are never reused, so stale entries are harmless
+        struct Slot {
+            uint64_t writer = 0;
+            Local* local = nullptr;
+        };
+
+        static inline std::atomic<uint64_t> next_id_{ 1 };
+
+        std::string path_;
+        size_t chunk_bytes_;
+        uint64_t id_ = next_id_.fetch_add(1);
+
+        std::mutex mutex_;                              // Guards the members below up to free_
+        std::vector<std::unique_ptr<Local>> locals_;
+        std::vector<int32_t> serials_;                  // Date grid of the first result
+        std::vector<std::unique_ptr<Chunk>> free_;      // Written chunks for reuse
+
+        BoundedQueue<std::unique_ptr<Chunk>> queue_;
+        std::thread thread_;
+        std::atomic<size_t> appended_{ 0 };
+        std::atomic<bool> closed_{ false };
+        std::atomic<bool> failed_{ false };
+
+        // Owned by the writer thread until it is joined
+        std::ofstream out_;
+        uint64_t offset_ = 0;
+        std::vector<ResultChunk> directory_;
+        uint64_t written_ = 0;
+        std::exception_ptr error_;
+
+        Local& local() {
+            thread_local std::array<Slot, 8> slots{};
+            thread_local size_t next = 0;
+            for (Slot& slot : slots) {
+                if (slot.writer == id_) return *slot.local;
+            }
+
+            std::lock_guard lock(mutex_);
+            locals_.push_back(std::make_unique<Local>());
+            slots[next++ % slots.size()] = { id_, locals_.back().get() };
+            return *locals_.back();
+        }
+
+        std::unique_ptr<Chunk> newChunk(const ProjectionResult& first) {
+            std::lock_guard lock(mutex_);
+            if (serials_.empty()) {
+                for (const Date& date : first.dates) {
+                    serials_.push_back(date.serial());
+                }
+            }
+
+            if (!free_.empty()) {
+                std::unique_ptr<Chunk> chunk = std::move(free_.back());
+                free_.pop_back();
+                chunk->count = 0;
+                return chunk;
+            }
+
+            auto chunk = std::make_unique<Chunk>();
+            chunk->steps = serials_.size();
+            size_t words = ResultFile::columnCount(chunk->steps);
+            chunk->capacity = std::max<size_t>(1, chunk_bytes_ / (words * sizeof(double)));
+            chunk->scenarios.resize(chunk->capacity);
+            chunk->values.resize(chunk->capacity * (words - 1));
+            return chunk;
+        }
+
+        void writeLoop() {
+            while (auto chunk = queue_.pop()) {
+                if (error_) continue;  // keep draining so appending threads never block
+                try {
+                    writeChunk(**chunk);
+                }
+                catch (...) {
+                    error_ = std::current_exception();
+                    failed_.store(true, std::memory_order_relaxed);
+                    continue;
+                }
+                std::lock_guard lock(mutex_);
+                free_.push_back(std::move(*chunk));
+            }
+        }
+
+        // Compacts a partial chunk's columns as it writes them
+        void writeChunk(const Chunk& chunk) {
+            size_t n = chunk.capacity, count = chunk.count, steps = chunk.steps;
+            const double* values = chunk.values.data();
+
+            directory_.push_back({ offset_, count });
+            writeColumn(chunk.scenarios.data(), count);
+            writeColumn(values, count);
+            writeColumn(values + n, count);
+            for (size_t series = 0; series < 4; ++series) {
+                writeColumn(values + 2 * n + series * n * steps, count * steps);
+            }
+            written_ += count;
+
+            if (!out_)
+                throw std::runtime_error("ResultWriter: write failed for " + path_);
+        }
+
+        void finish() {
+            ResultHeader header{};
+            std::memcpy(header.magic, ResultFile::Magic, sizeof(header.magic));
+            header.version = ResultFile::Version;
+            header.byte_order = ResultFile::ByteOrder;
+            header.result_count = written_;
+            header.step_count = static_cast<uint32_t>(serials_.size());
+            header.chunk_count = static_cast<uint32_t>(directory_.size());
+
+            header.dates_offset = offset_;
+            writeColumn(serials_.data(), serials_.size());
+            pad();
+            header.chunks_offset = offset_;
+            writeColumn(directory_.data(), directory_.size());
+
+            out_.seekp(0);
+            write(header);
+            out_.flush();
+            if (!out_)
+                throw std::runtime_error("ResultWriter: write failed for " + path_);
+        }
+
+        template <typename T>
+        void write(const T& value) {
+            out_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        void writeColumn(const T* data, size_t count) {
+            out_.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(count * sizeof(T)));
+            offset_ += count * sizeof(T);
+        }
+
+        void pad() {
+            static const char zeros[8] = {};
+            size_t padding = static_cast<size_t>((8 - offset_ % 8) % 8);
+            out_.write(zeros, static_cast<std::streamsize>(padding));
+            offset_ += padding;
+        }
+    };
+
+}
@@ -0,0 +1,288 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include "Date.h"
+#include "Philox.h"
+#include "TaskExecutor.h"
+#include "YieldCurve.h"
+
+namespace ALM {
+
+    /**
+     * @brief Weighted representative subset of a scenario set.
+     */
+    struct ReducedScenarios {
+        std::vector<size_t> medoids;                        ///< Original index of each representative; at most one per distinct scenario
+        std::vector<double> weights;                        ///< Share of the full set each represents; sums to 1
+        std::vector<size_t> cluster;                        ///< Representative (position in medoids) of each original scenario
+        std::vector<std::shared_ptr<YieldCurve>> curves;    ///< Representative curves, ready for MultiScenarioProjection
+        double mean_distance = 0.0;                         ///< Average distance from a scenario to its representative
+        int iterations = 0;
+
+        /// Full-set mean of a proxy metric and its error when estimated from the representatives
+        double proxy_mean = std::numeric_limits<double>::quiet_NaN();
+        double proxy_error = std::numeric_limits<double>::quiet_NaN();
+        /// Root mean square difference between each scenario's proxy and its representative's
+        double proxy_dispersion = std::numeric_limits<double>::quiet_NaN();
+
+        /**
+         * @brief Weighted mean of per-representative values, e.g. a metric from projecting curves.
+         */
+        double weightedMean(const std::vector<double>& values) const {
+            if (values.size() != weights.size())
+                throw std::invalid_argument("ReducedScenarios: need one value per representative");
+            double total = 0.0;
+            for (size_t j = 0; j < values.size(); ++j) {
+                total += weights[j] * values[j];
+            }
+            return total;
+        }
+    };
+
+    /**
+     * @brief Reduces a scenario set to k weighted representatives by k-medoids clustering.
+     *
+     * Each curve is described by its discount factors at fixed feature dates; scenarios are
+     * clustered on Euclidean distance between these vectors, seeded with k-medoids++ and refined
+     * by alternating assignment and medoid updates until the medoids stop moving. Features,
+     * assignments and medoid updates run in parallel on the executor. Every representative is
+     * an original scenario and is weighted by the share of scenarios in its cluster.
+     *
+     * The error on a target metric is estimated through a cheap proxy evaluated on every
+     * scenario (e.g. the liability PV on the curve): the reduction reports the proxy's error and
+     * its within-cluster dispersion. A target that moves with the proxy has a proportionate
+     * error; mean_distance bounds the error of any metric Lipschitz in the discount factors.
+     */
+    class ScenarioReducer {
+    public:
+        using Proxy = std::function<double(const YieldCurve&)>;
+
+        /**
+         * @param feature_dates Dates at which discount factors describe a curve.
+         * @param executor Executor for the parallel stages.
+         * @param seed Seed for the k-medoids++ initialisation.
+         * @param max_iterations Cap on assignment/update rounds.
+         * @param chunk Scenarios per task in the parallel stages.
+         */
+        ScenarioReducer(
+            std::vector<Date> feature_dates,
+            std::shared_ptr<TaskExecutor> executor,
+            uint64_t seed = 0,
+            int max_iterations = 50,
+            size_t chunk = 256)
+            : dates_(std::move(feature_dates)), executor_(std::move(executor)), rng_(seed),
+            max_iterations_(max_iterations), chunk_(std::max<size_t>(chunk, 1)) {
+            if (dates_.empty())
+                throw std::invalid_argument("ScenarioReducer: need at least one feature date");
+        }
+
+        /**
+         * @brief Feature dates every `step` from ref + step to ref + horizon.
+         */
+        static std::vector<Date> featureDates(Date ref, Duration horizon, Duration step = Duration(1, Duration::Unit::Years)) {
+            std::vector<Date> dates;
+            Date last = ref + horizon;
+            for (int i = 1; ; ++i) {
+                Date d = ref + Duration(i * step.amount, step.unit);
+                if (d > last) break;
+                dates.push_back(d);
+            }
+            return dates;
+        }
+
+        /**
+         * @brief Clusters the scenarios into k representatives.
+         *
+         * @param curves Full scenario set.
+         * @param k Number of representatives; fewer if the set has fewer distinct scenarios.
+         * @param proxy Optional cheap metric used to estimate the reduction error.
+         */
+        ReducedScenarios reduce(
+            const std::vector<std::shared_ptr<YieldCurve>>& curves,
+            size_t k,
+            const Proxy& proxy = nullptr) const {
+            size_t n = curves.size();
+            if (n == 0 || k == 0)
+                throw std::invalid_argument("ScenarioReducer: need scenarios and k > 0");
+            k = std::min(k, n);
+            size_t d = dates_.size();
+
+            // Features and proxy values
+            std::vector<double> x(n * d);
+            std::vector<double> proxy_values(proxy ? n : 0);
+            parallelFor(n, [&](size_t i) {
+                for (size_t j = 0; j < d; ++j) {
+                    x[i * d + j] = curves[i]->discount(dates_[j]);
+                }
+                if (proxy) proxy_values[i] = proxy(*curves[i]);
+                });
+
+            auto distance = [&](size_t a, size_t b) {
+                double sum = 0.0;
+                for (size_t j = 0; j < d; ++j) {
+                    double diff = x[a * d + j] - x[b * d + j];
+                    sum += diff * diff;
+                }
+                return sum;  // squared
+                };
+
+            ReducedScenarios result;
+            result.medoids = initialise(n, k, distance);
+            k = result.medoids.size();  // initialise stops at the number of distinct scenarios
+            result.cluster.assign(n, 0);
+
+            for (result.iterations = 1; result.iterations <= max_iterations_; ++result.iterations) {
+                // Assign each scenario to its nearest medoid
+                parallelFor(n, [&](size_t i) {
+                    double best = std::numeric_limits<double>::infinity();
+                    for (size_t c = 0; c < k; ++c) {
+                        double dist = distance(i, result.medoids[c]);
+                        if (dist < best) {
+                            best = dist;
+                            result.cluster[i] = c;
+                        }
+                    }
+                    });
+
+                // Move each medoid to the member minimising the total distance to its cluster
+                std::vector<std::vector<size_t>> members(k);
+                for (size_t i = 0; i < n; ++i) {
+                    members[result.cluster[i]].push_back(i);
+                }
+
+                std::vector<size_t> updated(result.medoids);
+                parallelFor(k, [&](size_t c) {
+                    double best = std::numeric_limits<double>::infinity();
+                    for (size_t candidate : members[c]) {
+                        double total = 0.0;
+                        for (size_t other : members[c]) {
+                            total += std::sqrt(distance(candidate, other));
+                            if (total >= best) break;
+                        }
+                        if (total < best) {
+                            best = total;
+                            updated[c] = candidate;
+                        }
+                    }
+                    });
+
+                if (updated == result.medoids) break;
+                result.medoids.swap(updated);
+            }
+            result.iterations = std::min(result.iterations, max_iterations_);
+
+            // Weights and error measures
+            result.weights.assign(k, 0.0);
+            double total_distance = 0.0;
+            for (size_t i = 0; i < n; ++i) {
+                result.weights[result.cluster[i]] += 1.0 / n;
+                total_distance += std::sqrt(distance(i, result.medoids[result.cluster[i]]));
+            }
+            result.mean_distance = total_distance / n;
+
+            for (size_t medoid : result.medoids) {
+                result.curves.push_back(curves[medoid]);
+            }
+
+            if (proxy) {
+                double full = 0.0, reduced = 0.0, squared = 0.0;
+                for (size_t i = 0; i < n; ++i) {
+                    double representative = proxy_values[result.medoids[result.cluster[i]]];
+                    full += proxy_values[i] / n;
+                    reduced += representative / n;
+                    squared += (proxy_values[i] - representative) * (proxy_values[i] - representative) / n;
+                }
+                result.proxy_mean = full;
+                result.proxy_error = reduced - full;
+                result.proxy_dispersion = std::sqrt(squared);
+            }
+
+            return result;
+        }
+
+    private:
+        std::vector<Date> dates_;
+        std::shared_ptr<TaskExecutor> executor_;
+        Philox4x32 rng_;
+        int max_iterations_;
+        size_t chunk_;
+
+        void parallelFor(size_t n, const std::function<void(size_t)>& body) const {
+            std::vector<std::function<void()>> tasks;
+            for (size_t begin = 0; begin < n; begin += chunk_) {
+                size_t end = std::min(begin + chunk_, n);
+                tasks.push_back([begin, end, &body]() {
+                    for (size_t i = begin; i < end; ++i) body(i);
+                    });
+            }
+            executor_->submitAndWait(tasks);
+        }
+
+        // k-medoids++: each new medoid drawn with probability proportional to squared distance
+        template <typename Distance>
+        std::vector<size_t> initialise(size_t n, size_t k, const Distance& distance) const {
+            std::vector<size_t> medoids;
+            medoids.push_back(static_cast<size_t>(uniform(0) * n) % n);
+
+            std::vector<double> nearest(n, std::numeric_limits<double>::infinity());
+            while (medoids.size() < k) {
+                size_t last = medoids.back();
+                parallelFor(n, [&](size_t i) {
+                    nearest[i] = std::min(nearest[i], distance(i, last));
+                    });
+
+                double total = 0.0;
+                for (double v : nearest) total += v;
+                if (total <= 0.0) break;  // fewer distinct scenarios than k
+
+                double target = uniform(medoids.size()) * total;
+                size_t pick = n;
+                for (size_t i = 0; i < n; ++i) {
+                    if (nearest[i] <= 0.0) continue;  // never a copy of a chosen medoid
+                    pick = i;
+                    target -= nearest[i];
+                    if (target < 0.0) break;
+                }
+                medoids.push_back(pick);
+            }
+            return medoids;
+        }
+
+        double uniform(uint64_t draw) const {
+            auto bits = rng_({ static_cast<uint32_t>(draw), static_cast<uint32_t>(draw >> 32), 0x4B4Du, 0u });
+            return (static_cast<double>(bits[0] >> 5) * 67108864.0 + (bits[1] >> 6)) * 0x1.0p-53;
+        }
+    };
+
+}
@@ -0,0 +1,299 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <span>
+#include <algorithm>
+#include <limits>
+#include <fstream>
+#include <stdexcept>
+#include "Date.h"
+#include "DayCounter.h"
+#include "YieldCurve.h"
+#include "MappedFile.h"
+
+namespace ALM {
+
+    /**
+     * @brief Fixed 64-byte header of a binary scenario cube file.
+     *
+     * The cube stores annually compounded zero rates as double[scenario][step][tenor] starting
+     * at rates_offset, preceded by the tenor grid (year fractions) at tenors_offset. Step s is
+     * the curve observed at reference + s * step_months months. Native byte order.
+     */
+    struct ScenarioHeader {
+        char magic[8];              ///< "ALMSCN\0\0"
+        uint32_t version;           ///< Format version, see ScenarioSet::Version
+        uint32_t byte_order;        ///< 0x01020304 in the writer's byte order
+        uint64_t scenario_count;
+        uint32_t step_count;        ///< Curves per scenario path
+        uint32_t tenor_count;       ///< Pillars per curve
+        int32_t reference;          ///< Date serial of step 0
+        uint32_t step_months;       ///< Months between steps
+        uint32_t day_counter;       ///< DayCounter::Convention used for year fractions
+        uint32_t reserved;
+        uint64_t tenors_offset;     ///< Byte offset of double[tenor_count]
+        uint64_t rates_offset;      ///< Byte offset of double[scenario_count * step_count * tenor_count]
+    };
+
+    static_assert(sizeof(ScenarioHeader) == 64, "ScenarioHeader layout is part of the file format");
+
+    class ScenarioSet;
+
+    /**
+     * @brief Lightweight YieldCurve view onto one curve of a ScenarioSet.
+     *
+     * Holds pointers into the cube, so creating one allocates nothing; the set must outlive it.
+     * Zero rates are linearly interpolated between pillars and held flat outside them.
+     */
+    class ScenarioCurve final : public YieldCurve {
+    public:
+        ScenarioCurve(const double* rates, std::span<const double> tenors, Date reference, DayCounter dc)
+            : rates_(rates), tenors_(tenors), ref_(reference), dc_(dc) {
+        }
+
+        double discount(const Date& t) const override {
+            double yf = dc_.yearFraction(ref_, t);
+            return std::exp(-yf * std::log1p(zeroAt(yf)));
+        }
+
+        double zero(const Date& t) const override {
+            return zeroAt(dc_.yearFraction(ref_, t));
+        }
+
+        double forward(const Date& t1, const Date& t2) const override {
+            double yf1 = dc_.yearFraction(ref_, t1);
+            double yf2 = dc_.yearFraction(ref_, t2);
+            if (yf2 <= yf1) return zeroAt(yf1);
+            return std::pow(discount(t1) / discount(t2), 1.0 / (yf2 - yf1)) - 1.0;
+        }
+
+        Date reference() const override {
+            return ref_;
+        }
+
+    private:
+        const double* rates_;
+        std::span<const double> tenors_;
+        Date ref_;
+        DayCounter dc_;
+
+        double zeroAt(double yf) const {
+            auto it = std::upper_bound(tenors_.begin(), tenors_.end(), yf);
+            if (it == tenors_.begin()) return rates_[0];
+            if (it == tenors_.end()) return rates_[tenors_.size() - 1];
+
+            size_t hi = static_cast<size_t>(it - tenors_.begin());
+            size_t lo = hi - 1;
+            double w = (yf - tenors_[lo]) / (tenors_[hi] - tenors_[lo]);
+            return rates_[lo] + w * (rates_[hi] - rates_[lo]);
+        }
+    };
+
+    /**
+     * @brief Contiguous cube of yield-curve scenarios, memory-mapped or held in memory.
+     *
+     * A mapped set is loaded zero-copy: opening validates the header and nothing is parsed.
+     * The mapping is read-only and shared, so worker processes mapping the same file share its
+     * pages. curve() returns ScenarioCurve views without allocating.
+     */
+    class ScenarioSet {
+    public:
+        static constexpr uint32_t Version = 1;
+        static constexpr char Magic[8] = { 'A', 'L', 'M', 'S', 'C', 'N', '\0', '\0' };
+        static constexpr uint32_t ByteOrder = 0x01020304;
+
+        /**
+         * @brief Map and validate a scenario cube file.
+         * @throws std::runtime_error if the file is missing, truncated, or not a supported version.
+         */
+        explicit ScenarioSet(const std::string& path)
+            : file_(path) {
+            if (file_.size() < sizeof(ScenarioHeader))
+                throw std::runtime_error("ScenarioSet: truncated header in " + path);
+
+            std::memcpy(&header_, file_.data(), sizeof(ScenarioHeader));
+
+            if (std::memcmp(header_.magic, Magic, sizeof(Magic)) != 0)
+                throw std::runtime_error("ScenarioSet: not a scenario file " + path);
+            if (header_.version != Version)
+                throw std::runtime_error("ScenarioSet: unsupported version " + std::to_string(header_.version) + " in " + path);
+            if (header_.byte_order != ByteOrder)
+                throw std::runtime_error("ScenarioSet: byte order mismatch in " + path);
+            if (header_.day_counter > static_cast<uint32_t>(DayCounter::Convention::Thirty360))
+                throw std::runtime_error("ScenarioSet: unknown day counter in " + path);
+
+            tenors_ = column(header_.tenors_offset, header_.tenor_count, path);
+            uint64_t rate_count = 0;
+            if (!product(header_.scenario_count, header_.step_count, header_.tenor_count, rate_count))
+                throw std::runtime_error("ScenarioSet: scenario, step and tenor counts overflow in " + path);
+            rates_ = column(header_.rates_offset, rate_count, path);
+            if (const char* error = shapeError())
+                throw std::runtime_error(std::string("ScenarioSet: ") + error + " in " + path);
+        }
+
+        /**
+         * @brief Build an in-memory set, e.g. from a scenario generator.
+         *
+         * @param reference Date of step 0.
+         * @param dc Day counter for year fractions.
+         * @param tenors Increasing pillar year fractions.
+         * @param scenario_count Number of scenarios.
+         * @param step_count Curves per scenario.
+         * @param step_months Months between steps.
+         * @param rates Zero rates laid out as [scenario][step][tenor].
+         */
+        ScenarioSet(
+            Date reference,
+            DayCounter::Convention dc,
+            std::vector<double> tenors,
+            size_t scenario_count,
+            size_t step_count,
+            uint32_t step_months,
+            std::vector<double> rates)
+            : tenor_storage_(std::move(tenors)), rate_storage_(std::move(rates)) {
+            header_ = makeHeader(reference, dc, tenor_storage_.size(), scenario_count, step_count, step_months);
+            tenors_ = tenor_storage_;
+            rates_ = rate_storage_;
+            uint64_t rate_count = 0;
+            if (!product(scenario_count, step_count, tenors_.size(), rate_count) || rates_.size() != rate_count)
+                throw std::invalid_argument("ScenarioSet: rates size does not match scenarios x steps x tenors");
+            if (const char* error = shapeError())
+                throw std::invalid_argument(std::string("ScenarioSet: ") + error);
+        }
+
+        // Views point into the owned storage or mapping
+        ScenarioSet(const ScenarioSet&) = delete;
+        ScenarioSet& operator=(const ScenarioSet&) = delete;
+        ScenarioSet(ScenarioSet&&) = default;
+        ScenarioSet& operator=(ScenarioSet&&) = default;
+
+        /// Number of scenarios
+        size_t size() const { return static_cast<size_t>(header_.scenario_count); }
+        size_t stepCount() const { return header_.step_count; }
+        size_t tenorCount() const { return header_.tenor_count; }
+        Date reference() const { return Date(header_.reference); }
+        DayCounter::Convention dayCounter() const { return static_cast<DayCounter::Convention>(header_.day_counter); }
+        uint32_t stepMonths() const { return header_.step_months; }
+
+        std::span<const double> tenors() const { return tenors_; }
+
+        /// Zero rates of one curve, one per tenor
+        std::span<const double> rates(size_t scenario, size_t step = 0) const {
+            return rates_.subspan((scenario * stepCount() + step) * tenorCount(), tenorCount());
+        }
+
+        /**
+         * @brief Curve view for a scenario at a step of its path.
+         *
+         * Step 0 is the scenario's curve as of reference(); step s is referenced
+         * s * stepMonths() months later.
+         */
+        ScenarioCurve curve(size_t scenario, size_t step = 0) const {
+            Date ref = reference() + Duration(static_cast<int>(step * header_.step_months), Duration::Unit::Months);
+            return ScenarioCurve(rates(scenario, step).data(), tenors_, ref, DayCounter(dayCounter()));
+        }
+
+        /**
+         * @brief Write the set in the binary cube format read by ScenarioSet(path).
+         * @throws std::runtime_error if the file cannot be written.
+         */
+        void write(const std::string& path) const {
+            ScenarioHeader header = header_;
+            header.tenors_offset = sizeof(ScenarioHeader);
+            header.rates_offset = header.tenors_offset + tenors_.size_bytes();
+
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            if (!out)
+                throw std::runtime_error("ScenarioSet: cannot open " + path);
+
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            out.write(reinterpret_cast<const char*>(tenors_.data()), tenors_.size_bytes());
+            out.write(reinterpret_cast<const char*>(rates_.data()), rates_.size_bytes());
+
+            if (!out)
+                throw std::runtime_error("ScenarioSet: write failed for " + path);
+        }
+
+    private:
+        MappedFile file_;
+        std::vector<double> tenor_storage_;
+        std::vector<double> rate_storage_;
+        ScenarioHeader header_;
+        std::span<const double> tenors_;
+        std::span<const double> rates_;
+
+        static ScenarioHeader makeHeader(
+            Date reference, DayCounter::Convention dc, size_t tenor_count,
+            size_t scenario_count, size_t step_count, uint32_t step_months) {
+            ScenarioHeader header{};
+            std::memcpy(header.magic, Magic, sizeof(header.magic));
+            header.version = Version;
+            header.byte_order = ByteOrder;
+            header.scenario_count = scenario_count;
+            header.step_count = static_cast<uint32_t>(step_count);
+            header.tenor_count = static_cast<uint32_t>(tenor_count);
+            header.reference = reference.serial();
+            header.step_months = step_months;
+            header.day_counter = static_cast<uint32_t>(dc);
+            return header;
+        }
+
+        // a * b * c, or false if it overflows
+        static bool product(uint64_t a, uint64_t b, uint64_t c, uint64_t& result) {
+            constexpr uint64_t max = std::numeric_limits<uint64_t>::max();
+            if (b != 0 && a > max / b) return false;
+            uint64_t ab = a * b;
+            if (c != 0 && ab > max / c) return false;
+            result = ab * c;
+            return true;
+        }
+
+        std::span<const double> column(uint64_t offset, uint64_t count, const std::string& path) const {
+            if (offset % alignof(double) != 0 || offset > file_.size()
+                || count > (file_.size() - offset) / sizeof(double))
+                throw std::runtime_error("ScenarioSet: column out of bounds in " + path);
+
+            return { reinterpret_cast<const double*>(file_.data() + offset), static_cast<size_t>(count) };
+        }
+
+        // What is wrong with the tenors or step count, or null; the caller picks the exception,
+        // since a bad file is a runtime_error and bad arguments an invalid_argument
+        const char* shapeError() const {
+            if (tenors_.empty() || header_.step_count == 0)
+                return "need at least one tenor and one step";
+            if (!std::is_sorted(tenors_.begin(), tenors_.end())
+                || std::adjacent_find(tenors_.begin(), tenors_.end()) != tenors_.end())
+                return "tenors must be strictly increasing";
+            return nullptr;
+        }
+    };
+
+}
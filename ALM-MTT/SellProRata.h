@@ -37,34 +37,45 @@ namespace ALM {
      *
      * If cash is negative, the strategy reduces each asset's volume by the same proportion
      * such that the total proceeds match the shortfall. If the shortfall is greater than the
-     * total market value, all assets are liquidated.
+     * total market value, all assets are liquidated. The sale is applied as an O(1) portfolio-wide
+     * scale, valued from the step's precomputed asset market value.
      */
-    class SellProRata : public Strategy {
+    class SellProRata final : public Strategy {
 
     public:
         void apply(
             Portfolio& portfolio,
             double& cash,
-            Date step_start,
-            Date step_end,
+            StepContext& step,
             const std::shared_ptr<const YieldCurve>& curve) override
+        {
+            apply(portfolio, cash, step, *curve);
+        }
+
+        /**
+         * @brief Statically dispatched form used by ProjectionKernel.
+         */
+        template <YieldCurveType Curve>
+        void apply(
+            Portfolio& portfolio,
+            double& cash,
+            StepContext& step,
+            const Curve&)
         {
             // No action needed if cash is positive
             if (cash >= 0.0)
                 return;
 
             double need = -cash;
-            double total_mv = portfolio.marketValue(curve, step_start);
+            double total_mv = step.assets_mv;
 
             if (total_mv <= 0.0)
                 return;
 
             double scalar = std::clamp(1.0 - (need / total_mv), 0.0, 1.0);
 
-            for (auto& asset : portfolio.assets()) {
-                double volume = asset.volume();
-                asset.setVolume(volume * scalar);
-            }
+            portfolio.scale(scalar);
+            step.assets_mv = total_mv * scalar;
 
             // Adjust cash depending on whether the shortfall was fully met
             cash = (scalar == 0.0) ? cash + total_mv : 0.0;
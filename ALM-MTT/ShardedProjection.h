@@ -0,0 +1,382 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <exception>
+#include <stdexcept>
+#include "Date.h"
+#include "TaskExecutor.h"
+#include "SingleThreadedExecutor.h"
+#include "ThreadPoolExecutor.h"
+#include "CancellationToken.h"
+#include "MultiScenarioProjection.h"
+#include "ResultFile.h"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace ALM {
+
+    /**
+     * @brief Runs a multi-scenario projection across forked worker processes on one machine.
+     *
+     * Each worker builds its own MultiScenarioProjection and executor from the factory after
+     * the fork, then claims chunks of scenarios from a counter in a shared anonymous mapping
+     * and writes every finished history into that scenario's slot of the same mapping. The
+     * parent reads the slots once all workers have exited, in scenario order, so every
+     * scenario's values are bitwise identical to a single-process run and anything reduced
+     * over them is summed in the same order. A result file holds the same records, but its
+     * record order and chunks follow whoever appended them (here the parent, in scenario order;
+     * in-process, each worker thread as it finishes), so compare files record by record
+     * through ResultFile::find rather than byte by byte.
+     *
+     * Read-only inputs are shared, not copied: workers inherit the parent's portfolios and
+     * reduced curves copy-on-write, and a memory-mapped ScenarioSet stays backed by the same
+     * page cache pages. Separate processes keep allocator arenas and thread pools apart, which
+     * is what stops a single process scaling on large multi-socket machines.
+     *
+     * Other threads of the parent may hold locks at the fork that stay locked in the workers,
+     * so the factory should only copy inputs the parent has already loaded, and must not log.
+     * POSIX only.
+     */
+    class ShardedProjection {
+    public:
+        /// Builds a worker's projection over the scenarios on the executor it is given
+        using Factory = std::function<MultiScenarioProjection(std::shared_ptr<TaskExecutor>)>;
+
+        /// Receives each result with its scenario index, in index order, on the calling thread
+        using ResultSink = MultiScenarioProjection::ResultSink;
+
+        /**
+         * @param factory Builds the projection in each worker; must yield scenario_count scenarios.
+         * @param scenario_count Number of scenarios of the factory's projection.
+         * @param start The projection start date, as given to the factory's projection.
+         * @param end The projection end date.
+         * @param step The projection step frequency.
+         * @param processes Worker processes to fork.
+         * @param threads Projection threads within each worker.
+         */
+        ShardedProjection(
+            Factory factory,
+            size_t scenario_count,
+            Date start,
+            Date end,
+            Duration step,
+            size_t processes,
+            size_t threads = 1) :
+            factory_(std::move(factory)),
+            count_(scenario_count),
+            processes_(std::max<size_t>(processes, 1)),
+            threads_(std::max<size_t>(threads, 1)) {
+            // The grid every kernel steps through, so slots can be sized before the fork
+            for (Date current = start; current < end; current = current + step) {
+                dates_.push_back(current);
+            }
+        }
+
+        /**
+         * @brief Sets a token that stops the run early.
+         *
+         * Workers stop claiming scenarios once the token fires and finish the chunk they are
+         * projecting. run() then leaves empty results for unfinished scenarios; status() reports
+         * how many finished.
+         */
+        void setCancellation(CancellationToken token) {
+            cancellation_ = std::move(token);
+        }
+
+        /// Completion status of the last run
+        const BatchStatus& status() const {
+            return status_;
+        }
+
+        /// Number of scenarios
+        size_t size() const {
+            return count_;
+        }
+
+        /**
+         * @brief Runs the projection over all scenarios.
+         * @return One ProjectionResult per scenario, in scenario order.
+         * @throws std::runtime_error naming the first worker that failed or could not be started.
+         */
+        std::vector<ProjectionResult> run() {
+            std::vector<ProjectionResult> results(count_);
+            run([&results](size_t i, ProjectionResult result) {
+                results[i] = std::move(result);
+                });
+            return results;
+        }
+
+        /**
+         * @brief Runs the projection over all scenarios, appending each result to a writer in
+         *        scenario order. The writer is left open.
+         */
+        void run(ResultWriter& writer) {
+            run([&writer](size_t i, ProjectionResult result) {
+                writer.append(i, result);
+                });
+        }
+
+        /**
+         * @brief Runs the projection over all scenarios, then passes each finished result to
+         *        sink in scenario order.
+         */
+        void run(const ResultSink& sink) {
+#ifdef _WIN32
+            (void)sink;
+            throw std::runtime_error("ShardedProjection: worker processes are not supported on this platform");
+#else
+            status_ = BatchStatus{};
+            if (count_ == 0) return;
+
+            Layout layout(count_, dates_.size(), processes_);
+            SharedRegion region(layout.bytes);
+            Control* control = new (region.data()) Control();
+
+            // Small enough chunks that a worker stuck with slow scenarios does not hold up the rest
+            size_t chunk = std::max<size_t>(1, count_ / (processes_ * 8));
+
+            std::vector<pid_t> workers;
+            workers.reserve(processes_);
+            for (size_t w = 0; w < processes_; ++w) {
+                pid_t pid = ::fork();
+                if (pid == 0)
+                    ::_exit(work(w, chunk, layout, region.data()));
+                if (pid < 0) {
+                    control->stop.store(1, std::memory_order_relaxed);
+                    wait(workers, layout, region.data());
+                    throw std::runtime_error("ShardedProjection: cannot start worker process " + std::to_string(w));
+                }
+                workers.push_back(pid);
+            }
+
+            std::string failure = wait(workers, layout, region.data());
+            if (!failure.empty())
+                throw std::runtime_error(failure);
+
+            status_.cancelled = control->stop.load(std::memory_order_relaxed) != 0;
+            const uint8_t* done = reinterpret_cast<const uint8_t*>(region.data() + layout.done);
+            for (size_t i = 0; i < count_; ++i) {
+                if (!done[i]) {
+                    ++status_.skipped;
+                    continue;
+                }
+                ++status_.completed;
+                sink(i, load(layout, region.data(), i));
+            }
+#endif
+        }
+
+    private:
+        static constexpr size_t ErrorSize = 256;
+
+        Factory factory_;
+        size_t count_;
+        size_t processes_;
+        size_t threads_;
+        std::vector<Date> dates_;
+        CancellationToken cancellation_;
+        BatchStatus status_;
+
+        static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free,
+            "Control is shared between processes, which only lock-free atomics support");
+
+        // Head of the shared mapping
+        struct Control {
+            std::atomic<uint64_t> next{ 0 };        // First scenario of the next unclaimed chunk
+            std::atomic<uint32_t> stop{ 0 };        // Raised on cancellation or a worker failure
+        };
+
+        // Byte offsets of the columns that follow Control, each 64-byte aligned
+        struct Layout {
+            size_t steps = 0;
+            size_t errors = 0;          // char[processes][ErrorSize], why a worker failed
+            size_t done = 0;            // uint8_t[n], set once a scenario's slot is written
+            size_t values = 0;          // double[n] scalar, then double[n] ending_surplus
+            size_t series = 0;          // double[n][steps] each of assets, liabilities, cash, surplus
+            size_t bytes = 0;
+
+            Layout(size_t n, size_t step_count, size_t processes) : steps(step_count) {
+                auto align = [](size_t offset) { return (offset + 63) & ~size_t(63); };
+                errors = align(sizeof(Control));
+                done = align(errors + processes * ErrorSize);
+                values = align(done + n);
+                series = align(values + 2 * n * sizeof(double));
+                bytes = series + 4 * n * steps * sizeof(double);
+            }
+        };
+
+#ifndef _WIN32
+        // Anonymous mapping shared with the processes forked while it is mapped; starts zeroed
+        class SharedRegion {
+        public:
+            explicit SharedRegion(size_t bytes) : size_(bytes) {
+                void* view = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+                if (view == MAP_FAILED)
+                    throw std::runtime_error("ShardedProjection: cannot map " + std::to_string(size_) + " bytes of shared memory");
+                data_ = static_cast<std::byte*>(view);
+            }
+
+            ~SharedRegion() {
+                ::munmap(data_, size_);
+            }
+
+            SharedRegion(const SharedRegion&) = delete;
+            SharedRegion& operator=(const SharedRegion&) = delete;
+
+            std::byte* data() const { return data_; }
+
+        private:
+            std::byte* data_ = nullptr;
+            size_t size_ = 0;
+        };
+
+        // Body of worker process w; returns its exit code
+        int work(size_t w, size_t chunk, const Layout& layout, std::byte* base) noexcept {
+            Control* control = reinterpret_cast<Control*>(base);
+            try {
+                std::shared_ptr<TaskExecutor> executor;
+                if (threads_ > 1) executor = std::make_shared<ThreadPoolExecutor>(threads_);
+                else executor = std::make_shared<SingleThreadedExecutor>();
+
+                MultiScenarioProjection projection = factory_(std::move(executor));
+                if (projection.size() != count_)
+                    throw std::runtime_error("factory built " + std::to_string(projection.size())
+                        + " scenarios, expected " + std::to_string(count_));
+
+                while (!control->stop.load(std::memory_order_relaxed)) {
+                    size_t first = static_cast<size_t>(control->next.fetch_add(chunk, std::memory_order_relaxed));
+                    if (first >= count_) break;
+                    projection.run(first, std::min(chunk, count_ - first), [&](size_t i, ProjectionResult result) {
+                        store(layout, base, i, result);
+                        });
+                }
+                return 0;
+            }
+            catch (const std::exception& e) {
+                std::snprintf(reinterpret_cast<char*>(base + layout.errors + w * ErrorSize), ErrorSize, "%s", e.what());
+            }
+            catch (...) {
+            }
+            control->stop.store(1, std::memory_order_relaxed);
+            return 1;
+        }
+
+        // Reaps every worker, raising the stop flag once the token fires or a worker fails;
+        // returns the first failure, or an empty string
+        std::string wait(std::vector<pid_t> workers, const Layout& layout, std::byte* base) {
+            Control* control = reinterpret_cast<Control*>(base);
+            std::string failure;
+            size_t running = workers.size();
+
+            while (running > 0) {
+                if (cancellation_.cancelled())
+                    control->stop.store(1, std::memory_order_relaxed);
+
+                for (size_t w = 0; w < workers.size(); ++w) {
+                    if (workers[w] == 0) continue;
+
+                    int status = 0;
+                    pid_t pid = ::waitpid(workers[w], &status, WNOHANG);
+                    if (pid == 0 || (pid < 0 && errno == EINTR)) continue;
+                    workers[w] = 0;
+                    --running;
+
+                    if (pid > 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0) continue;
+                    control->stop.store(1, std::memory_order_relaxed);
+                    if (!failure.empty()) continue;
+
+                    const char* message = reinterpret_cast<const char*>(base + layout.errors + w * ErrorSize);
+                    failure = "ShardedProjection: worker " + std::to_string(w);
+                    if (pid < 0) failure += " was lost";
+                    else if (WIFSIGNALED(status)) failure += " killed by signal " + std::to_string(WTERMSIG(status));
+                    else if (message[0] != '\0') failure += ": " + std::string(message, strnlen(message, ErrorSize));
+                    else failure += " failed";
+                }
+
+                if (running > 0) std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+            return failure;
+        }
+#endif
+
+        static double* column(const Layout& layout, std::byte* base, size_t series, size_t n, size_t i) {
+            return reinterpret_cast<double*>(base + layout.series) + (series * n + i) * layout.steps;
+        }
+
+        void store(const Layout& layout, std::byte* base, size_t i, const ProjectionResult& result) const {
+            if (result.dates.size() != layout.steps || result.assets_bop.size() != layout.steps)
+                throw std::runtime_error("scenario " + std::to_string(i) + " has " + std::to_string(result.dates.size())
+                    + " dates, expected " + std::to_string(layout.steps));
+
+            double* values = reinterpret_cast<double*>(base + layout.values);
+            values[i] = result.scalar;
+            values[count_ + i] = result.ending_surplus;
+            std::copy(result.assets_bop.begin(), result.assets_bop.end(), column(layout, base, 0, count_, i));
+            std::copy(result.liabilities_bop.begin(), result.liabilities_bop.end(), column(layout, base, 1, count_, i));
+            std::copy(result.cash_bop.begin(), result.cash_bop.end(), column(layout, base, 2, count_, i));
+            std::copy(result.surplus_bop.begin(), result.surplus_bop.end(), column(layout, base, 3, count_, i));
+            reinterpret_cast<uint8_t*>(base + layout.done)[i] = 1;
+        }
+
+        ProjectionResult load(const Layout& layout, std::byte* base, size_t i) const {
+            const double* values = reinterpret_cast<const double*>(base + layout.values);
+            auto series = [&](size_t s) {
+                const double* first = column(layout, base, s, count_, i);
+                return std::vector<double>(first, first + layout.steps);
+                };
+
+            ProjectionResult result;
+            result.scalar = values[i];
+            result.dates = dates_;
+            result.assets_bop = series(0);
+            result.liabilities_bop = series(1);
+            result.cash_bop = series(2);
+            result.surplus_bop = series(3);
+            result.ending_surplus = values[count_ + i];
+            return result;
+        }
+    };
+
+}
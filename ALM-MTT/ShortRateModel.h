@@ -0,0 +1,84 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <vector>
+#include "Date.h"
+#include "DayCounter.h"
+
+namespace ALM {
+
+    /**
+     * @brief Abstract one-factor short-rate model for scenario generation.
+     *
+     * The model evolves a state variable x over a time grid; the short rate on step i is
+     * shortRate(x_i) + shift_i, where the deterministic shift (zero unless the model is fitted to
+     * an initial curve) is computed once per grid by shift(). Models are immutable and may be
+     * shared across threads.
+     */
+    class ShortRateModel {
+    public:
+        virtual ~ShortRateModel() = default;
+
+        /// State at the reference date
+        virtual double initialState() const = 0;
+
+        /**
+         * @brief Advances the state by one step.
+         *
+         * @param x State at the start of the step.
+         * @param dt Step length in years.
+         * @param z Standard normal draw for the step.
+         */
+        virtual double evolve(double x, double dt, double z) const = 0;
+
+        /**
+         * @brief Model price at ref of a zero-coupon bond paying 1 at t, E[exp(-integral of r)].
+         *
+         * Closed form for the affine models; known means for control variates.
+         */
+        virtual double discount(const Date& ref, const Date& t, const DayCounter& dc) const = 0;
+
+        /// Continuously compounded short rate implied by a state, before the shift
+        virtual double shortRate(double x) const {
+            return x;
+        }
+
+        /**
+         * @brief Deterministic shift of the short rate at each grid date.
+         *
+         * @param dates Grid dates, dates[0] the reference date.
+         * @param dc Day counter for year fractions.
+         * @return One shift per step (dates.size() - 1 values).
+         */
+        virtual std::vector<double> shift(const std::vector<Date>& dates, const DayCounter&) const {
+            return std::vector<double>(dates.empty() ? 0 : dates.size() - 1, 0.0);
+        }
+
+    protected:
+        ShortRateModel() = default;
+    };
+
+}
@@ -0,0 +1,270 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include "Date.h"
+#include "DayCounter.h"
+#include "Philox.h"
+#include "SobolSequence.h"
+#include "BrownianBridge.h"
+#include "ShortRateModel.h"
+#include "TaskExecutor.h"
+#include "YieldCurve.h"
+#include "InterpolatedCurve.h"
+
+namespace ALM {
+
+    /**
+     * @brief How ShortRateScenarioGenerator produces the normal draws of each path.
+     */
+    struct ScenarioSampling {
+        enum class Method {
+            PseudoRandom,   ///< Philox draws, one stream per path
+            Sobol           ///< Digitally shifted Sobol points, one point per path
+        };
+
+        Method method = Method::PseudoRandom;
+        bool brownian_bridge = false;   ///< Build each path by bisection from its terminal value
+        bool antithetic = false;        ///< Scenarios 2m and 2m + 1 use opposite draws
+        size_t replicate_size = 0;      ///< Sobol points per independent random shift; 0 = one shift
+    };
+
+    /**
+     * @brief Generates yield curve scenarios from simulated short-rate paths.
+     *
+     * Scenario k simulates the model on a fixed date grid and is returned as the path's
+     * pathwise discount curve: the discount factor to grid date i is exp(-sum r_j dt_j) over the
+     * steps before it, log-linear in between (the short rate held over each step) and the last
+     * rate extrapolated. Valuing at a later date with such a curve gives the forward value along
+     * that path.
+     *
+     * Normal draws come from Philox4x32 with scenario k as the stream, so a scenario depends only
+     * on the seed and k: it is identical however scenarios are split across threads or chunks,
+     * and any scenario can be regenerated on its own. All curves share one InterpolatedCurve
+     * layout. The generator is immutable and may be shared across threads.
+     *
+     * Sampling can instead use a digitally shifted Sobol sequence (one dimension per step),
+     * Brownian-bridge path construction and antithetic pairs. Scenarios stay reproducible by
+     * index under every option. groupSize() gives the number of consecutive scenarios that form
+     * one independent sample, as MonteCarloEstimator needs for error estimates.
+     */
+    class ShortRateScenarioGenerator {
+    public:
+        using Sampling = ScenarioSampling;
+
+        /**
+         * @param model Short-rate model.
+         * @param ref Scenario reference date.
+         * @param end Last date the scenarios must cover.
+         * @param step Simulation step.
+         * @param seed RNG key; different seeds give independent scenario sets.
+         * @param dc Day counter for step lengths and curve year fractions.
+         * @param grid_days Lookup grid spacing of the scenario curves, see InterpolatedCurve.
+         * @param sampling Draw generation; plain pseudo-random by default.
+         */
+        ShortRateScenarioGenerator(
+            std::shared_ptr<const ShortRateModel> model,
+            Date ref,
+            Date end,
+            Duration step = Duration(1, Duration::Unit::Months),
+            uint64_t seed = 0,
+            DayCounter dc = DayCounter(DayCounter::Convention::ActualActual),
+            int grid_days = 1,
+            Sampling sampling = Sampling())
+            : model_(std::move(model)), dc_(dc), rng_(seed), sampling_(sampling) {
+            if (!model_)
+                throw std::invalid_argument("ShortRateScenarioGenerator: model is required");
+            if (end <= ref || step.amount <= 0)
+                throw std::invalid_argument("ShortRateScenarioGenerator: need end after ref and a positive step");
+
+            dates_.push_back(ref);
+            for (int i = 1; dates_.back() < end; ++i) {
+                dates_.push_back(ref + Duration(i * step.amount, step.unit));
+            }
+
+            for (size_t i = 0; i + 1 < dates_.size(); ++i) {
+                dt_.push_back(dc_.yearFraction(dates_[i], dates_[i + 1]));
+            }
+            shift_ = model_->shift(dates_, dc_);
+
+            std::vector<Date> pillars(dates_.begin() + 1, dates_.end());
+            layout_ = std::make_shared<const InterpolatedCurve::Layout>(ref, pillars, dc_, grid_days);
+
+            if (sampling_.method == Sampling::Method::Sobol)
+                sobol_.emplace(steps());
+            if (sampling_.brownian_bridge)
+                bridge_.emplace(dt_);
+        }
+
+        /// Number of simulation steps
+        size_t steps() const {
+            return dt_.size();
+        }
+
+        /// Simulation grid, starting at the reference date
+        const std::vector<Date>& dates() const {
+            return dates_;
+        }
+
+        /**
+         * @brief Consecutive scenarios forming one independent sample; 0 if the whole set is one
+         *        (a single Sobol shift).
+         */
+        size_t groupSize() const {
+            size_t pair = sampling_.antithetic ? 2 : 1;
+            if (sampling_.method == Sampling::Method::Sobol)
+                return sampling_.replicate_size * pair;
+            return pair;
+        }
+
+        /**
+         * @brief Standardised normal increments driving a scenario, one per step.
+         */
+        std::vector<double> draws(size_t scenario) const {
+            uint64_t draw = sampling_.antithetic ? scenario / 2 : scenario;
+
+            std::vector<double> e(steps());
+            if (sobol_) {
+                size_t block = sampling_.replicate_size;
+                uint64_t replicate = block ? draw / block : 0;
+                uint64_t point = block ? draw % block : draw;
+                std::vector<uint32_t> shift = sobol_->shift(rng_, replicate);
+                sobol_->normals(point, shift.data(), e.data());
+            }
+            else {
+                rng_.normals(draw, 0, e.data(), e.size());
+            }
+
+            std::vector<double> z(steps());
+            if (bridge_)
+                bridge_->transform(e.data(), z.data());
+            else
+                z.swap(e);
+
+            if (sampling_.antithetic && (scenario & 1))
+                for (auto& x : z) x = -x;
+
+            return z;
+        }
+
+        /**
+         * @brief Simulated short rate over each step of a scenario.
+         */
+        std::vector<double> shortRates(size_t scenario) const {
+            std::vector<double> z = draws(scenario);
+
+            std::vector<double> rates(steps());
+            double x = model_->initialState();
+            for (size_t i = 0; i < steps(); ++i) {
+                rates[i] = model_->shortRate(x) + shift_[i];
+                x = model_->evolve(x, dt_[i], z[i]);
+            }
+            return rates;
+        }
+
+        /**
+         * @brief Pathwise discount curve of a scenario.
+         */
+        std::shared_ptr<InterpolatedCurve> scenario(size_t scenario) const {
+            std::vector<double> rates = shortRates(scenario);
+
+            std::vector<double> discounts(steps());
+            double log_discount = 0.0;
+            for (size_t i = 0; i < steps(); ++i) {
+                log_discount -= rates[i] * dt_[i];
+                discounts[i] = std::exp(log_discount);
+            }
+            return std::make_shared<InterpolatedCurve>(layout_, discounts, InterpolatedCurve::Interpolation::LogLinear);
+        }
+
+        /**
+         * @brief The model's analytic discount curve on the scenario grid.
+         *
+         * Its discount factors are the expectations of the scenario curves' (up to time
+         * discretisation), so e.g. a liability PV on it is the known mean for a control variate.
+         */
+        std::shared_ptr<InterpolatedCurve> expectedCurve() const {
+            std::vector<double> discounts;
+            discounts.reserve(steps());
+            for (size_t i = 1; i < dates_.size(); ++i) {
+                discounts.push_back(model_->discount(dates_[0], dates_[i], dc_));
+            }
+            return std::make_shared<InterpolatedCurve>(layout_, discounts, InterpolatedCurve::Interpolation::LogLinear);
+        }
+
+        /**
+         * @brief Generates a block of scenarios in parallel.
+         *
+         * @param first Index of the first scenario.
+         * @param count Number of scenarios.
+         * @param executor Executor for the chunks.
+         * @param chunk Scenarios per task.
+         * @return Curves for scenarios first .. first + count - 1, in order.
+         */
+        std::vector<std::shared_ptr<YieldCurve>> generate(
+            size_t first,
+            size_t count,
+            TaskExecutor& executor,
+            size_t chunk = 16) const {
+            std::vector<std::shared_ptr<YieldCurve>> curves(count);
+            std::vector<std::function<void()>> tasks;
+            chunk = std::max<size_t>(chunk, 1);
+
+            for (size_t begin = 0; begin < count; begin += chunk) {
+                size_t end = std::min(begin + chunk, count);
+                tasks.push_back([this, first, begin, end, &curves]() {
+                    for (size_t i = begin; i < end; ++i) {
+                        curves[i] = scenario(first + i);
+                    }
+                    });
+            }
+
+            executor.submitAndWait(tasks);
+
+            return curves;
+        }
+
+    private:
+        std::shared_ptr<const ShortRateModel> model_;
+        DayCounter dc_;
+        Philox4x32 rng_;
+        Sampling sampling_;
+        std::optional<SobolSequence> sobol_;
+        std::optional<BrownianBridge> bridge_;
+        std::vector<Date> dates_;
+        std::vector<double> dt_;     // step lengths in years
+        std::vector<double> shift_;  // deterministic short-rate shift per step
+        std::shared_ptr<const InterpolatedCurve::Layout> layout_;
+    };
+
+}
@@ -27,6 +27,7 @@
 #include <vector>
 #include <functional>
 #include "TaskExecutor.h"
+#include "Trace.h"
 
 namespace ALM {
 
@@ -35,7 +36,10 @@ namespace ALM {
      */
     class SingleThreadedExecutor : public TaskExecutor {
     public:
+        using TaskExecutor::submitAndWait;
+
         void submitAndWait(const std::vector<std::function<void()>>& tasks) override {
+            ALM_TRACE_SCOPE("executor", "SingleThreadedExecutor::submitAndWait");
             for (const auto& task : tasks) {
                 task();
             }
@@ -0,0 +1,182 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <stdexcept>
+#include "Philox.h"
+#include "SobolDirections.h"
+
+namespace ALM {
+
+    /**
+     * @brief Sobol low-discrepancy sequence with Joe-Kuo direction numbers, up to 1024 dimensions.
+     *
+     * Points are computed directly from their index (Gray code), so point n is the same however
+     * the sequence is split across threads. An optional random digital shift, drawn from Philox,
+     * randomises the sequence while keeping its stratification; independent shifts give the
+     * independent replicates needed to estimate the error of a quasi-Monte Carlo mean.
+     */
+    class SobolSequence {
+    public:
+        static constexpr size_t MaxDimension = SobolDirections::Dimensions;
+
+        explicit SobolSequence(size_t dimension)
+            : dimension_(dimension), directions_(dimension * Bits) {
+            if (dimension == 0 || dimension > MaxDimension)
+                throw std::invalid_argument("SobolSequence: dimension must be between 1 and "
+                    + std::to_string(MaxDimension));
+
+            // Dimension 1 is the van der Corput sequence
+            for (int k = 0; k < Bits; ++k) {
+                directions_[k] = 1u << (Bits - 1 - k);
+            }
+
+            const uint16_t* row = SobolDirections::Data;
+            for (size_t d = 1; d < dimension_; ++d) {
+                int s = row[0];
+                uint32_t a = row[1];
+                const uint16_t* m = row + 2;
+                uint32_t* v = &directions_[d * Bits];
+
+                for (int k = 0; k < s && k < Bits; ++k) {
+                    v[k] = static_cast<uint32_t>(m[k]) << (Bits - 1 - k);
+                }
+                for (int k = s; k < Bits; ++k) {
+                    v[k] = v[k - s] ^ (v[k - s] >> s);
+                    for (int j = 1; j < s; ++j) {
+                        if ((a >> (s - 1 - j)) & 1u) v[k] ^= v[k - j];
+                    }
+                }
+                row += 2 + s;
+            }
+        }
+
+        size_t dimension() const {
+            return dimension_;
+        }
+
+        /**
+         * @brief Integer coordinates of point n, digitally shifted.
+         *
+         * @param n Point index.
+         * @param shift Per-dimension XOR shift, or nullptr for the plain sequence.
+         * @param out Destination for dimension() coordinates in units of 2^-32.
+         */
+        void point(uint64_t n, const uint32_t* shift, uint32_t* out) const {
+            uint64_t gray = n ^ (n >> 1);
+            for (size_t d = 0; d < dimension_; ++d) {
+                out[d] = shift ? shift[d] : 0u;
+            }
+            for (int k = 0; gray != 0 && k < Bits; ++k, gray >>= 1) {
+                if (!(gray & 1u)) continue;
+                for (size_t d = 0; d < dimension_; ++d) {
+                    out[d] ^= directions_[d * Bits + k];
+                }
+            }
+        }
+
+        /**
+         * @brief Standard normal coordinates of point n by inversion.
+         *
+         * Coordinates are mapped to cell midpoints (x + 0.5) / 2^32, so no point sits on 0 or 1.
+         */
+        void normals(uint64_t n, const uint32_t* shift, double* out) const {
+            std::vector<uint32_t> bits(dimension_);
+            point(n, shift, bits.data());
+            for (size_t d = 0; d < dimension_; ++d) {
+                out[d] = inverseNormal((static_cast<double>(bits[d]) + 0.5) * 0x1.0p-32);
+            }
+        }
+
+        /**
+         * @brief Random digital shift for one replicate.
+         *
+         * @param rng Counter-based generator keyed by the user seed.
+         * @param replicate Replicate index; each gives an independent shift.
+         */
+        std::vector<uint32_t> shift(const Philox4x32& rng, uint64_t replicate) const {
+            std::vector<uint32_t> shift(dimension_);
+            for (size_t d = 0; d < dimension_; d += 4) {
+                auto bits = rng({ static_cast<uint32_t>(d), static_cast<uint32_t>(replicate),
+                    static_cast<uint32_t>(replicate >> 32), 0x50B01u });
+                for (size_t j = 0; j < 4 && d + j < dimension_; ++j) {
+                    shift[d + j] = bits[j];
+                }
+            }
+            return shift;
+        }
+
+        /**
+         * @brief Inverse standard normal CDF.
+         *
+         * Acklam's rational approximation (relative error 1.2e-9) refined by one Halley step,
+         * which brings it to double precision.
+         */
+        static double inverseNormal(double p) {
+            static constexpr double a[] = { -3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00 };
+            static constexpr double b[] = { -5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+                6.680131188771972e+01, -1.328068155288572e+01 };
+            static constexpr double c[] = { -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00 };
+            static constexpr double d[] = { 7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+                3.754408661907416e+00 };
+            constexpr double low = 0.02425;
+
+            double x;
+            if (p < low) {
+                double q = std::sqrt(-2.0 * std::log(p));
+                x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5])
+                    / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+            }
+            else if (p <= 1.0 - low) {
+                double q = p - 0.5;
+                double r = q * q;
+                x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q
+                    / (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+            }
+            else {
+                double q = std::sqrt(-2.0 * std::log1p(-p));
+                x = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5])
+                    / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+            }
+
+            // Halley refinement against the exact CDF
+            double e = 0.5 * std::erfc(-x / std::sqrt(2.0)) - p;
+            double u = e * std::sqrt(2.0 * 3.14159265358979323846) * std::exp(0.5 * x * x);
+            return x - u / (1.0 + 0.5 * x * u);
+        }
+
+    private:
+        static constexpr int Bits = 32;
+
+        size_t dimension_;
+        std::vector<uint32_t> directions_;  // [dimension][bit], bit 0 most significant
+    };
+
+}
@@ -24,7 +24,7 @@
 
 #pragma once
 
-#include <Eigen/dense>
+#include <Eigen/Dense>
 #include <functional>
 #include "TaskExecutor.h"
 #include "SingleThreadedExecutor.h"
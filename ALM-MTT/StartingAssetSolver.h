@@ -24,6 +24,11 @@
 
 #pragma once
 
+#include <cmath>
+#include <optional>
+#include <algorithm>
+#include <functional>
+
 #include "Projection.h"
 #include "BrentSolver.h"
 
@@ -40,7 +45,8 @@ namespace ALM {
         /**
          * @brief Solves for the asset scale factor that zeroes out the final surplus.
          *
-         * @param projection The projection to evaluate (will be called repeatedly).
+         * @param projection The projection to evaluate (will be called repeatedly); a Projection or
+         *                   any ProjectionKernel.
          * @param max_evaluations Maximum number of solver iterations.
          * @param tolerance Absolute tolerance for the surplus target.
          * @param guess Initial guess for the scaling factor.
@@ -48,8 +54,9 @@ namespace ALM {
          * @param upper_bound Upper bound of search interval.
          * @return Scaling factor such that projection.run(scale).ending_surplus ≈ 0.
          */
+        template <typename ProjectionT>
         double solve(
-            Projection& projection,
+            ProjectionT& projection,
             int max_evaluations = 1000,
             double lower_bound = 0.0,
             double upper_bound = 100.0,
@@ -64,6 +71,42 @@ namespace ALM {
 
             return solver.solve(f, lower_bound, upper_bound, guess);
         }
+
+        /**
+         * @brief Solves for the scale factor only if it exceeds a moving threshold.
+         *
+         * Used to find a maximum across scenarios. A single projection at the threshold settles
+         * most scenarios: the surplus increases with the scale, so a non-negative surplus there
+         * places the solution at or below it. Otherwise the solve runs on [threshold, upper_bound]
+         * and is abandoned as soon as its bracket lies entirely at or below the threshold, which
+         * other scenarios may raise while it runs.
+         *
+         * @param threshold Current threshold on the scale factor; may increase between calls.
+         * @return The scale factor, or nothing once it is shown not to exceed the threshold.
+         */
+        template <typename ProjectionT>
+        std::optional<double> solveAbove(
+            ProjectionT& projection,
+            const std::function<double()>& threshold,
+            double upper_bound = 100.0)
+        {
+            double lower_bound = std::max(threshold(), 0.0);
+            if (lower_bound >= upper_bound) return std::nullopt;
+
+            // The bound check doubles as the solver's first evaluation
+            double at_lower = projection.run(lower_bound).ending_surplus;
+            if (lower_bound > 0.0 && at_lower >= 0.0) return std::nullopt;
+
+            auto f = [&](double scalar) {
+                return scalar == lower_bound ? at_lower : projection.run(scalar).ending_surplus;
+                };
+
+            BrentSolver solver;
+            double scalar = solver.solve(f, lower_bound, upper_bound, lower_bound,
+                [&](double, double high) { return high <= threshold(); });
+            if (std::isnan(scalar)) return std::nullopt;
+            return scalar;
+        }
     };
 
 }
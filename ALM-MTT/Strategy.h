@@ -32,11 +32,32 @@
 
 namespace ALM {
 
+    /**
+     * @brief Per-step state handed to a strategy by the projection.
+     *
+     * Carries the valuations the projection has already computed for the step so that
+     * strategies do not need to reprice the book. Strategies that trade update `assets_mv`
+     * so that later strategies applied in the same step see the current book value.
+     */
+    struct StepContext {
+        Date step_start;              ///< Start of the projection period
+        Date step_end;                ///< End of the projection period
+        double assets_mv = 0.0;       ///< Market value of the asset portfolio at step_start
+        double liabilities_mv = 0.0;  ///< Market value of the liabilities at step_start
+        double asset_cf = 0.0;        ///< Asset cash flows received over the period
+        double liability_cf = 0.0;    ///< Liability cash flows paid over the period
+    };
+
     /**
      * @brief Abstract base class for reinvestment/disinvestment strategies in ALM projections.
      *
      * A strategy is applied at each projection step and can modify the portfolio and cash balance.
      * Implementations may choose to buy, sell, or hold assets based on current state.
+     *
+     * Thread safety: MultiScenarioProjection runs scenarios concurrently and calls clone() once per
+     * scenario. Stateless strategies keep the default, which shares the instance across all
+     * scenario threads, so apply() must not modify members. Strategies with per-scenario state
+     * override clone() to hand each scenario its own copy.
      */
     class Strategy {
 
@@ -51,17 +72,23 @@ namespace ALM {
          *
          * @param portfolio The portfolio to be adjusted.
          * @param cash Current cash available (can be negative for shortfall).
-         * @param step_start Start of the projection period.
-         * @param step_end End of the projection period.
+         * @param step Dates and valuations for the current projection period.
          * @param curve Yield curve used for pricing or reinvestment logic.
-         * @param executor Task executor for parallel portfolio operations.
          */
         virtual void apply(
             Portfolio& portfolio,
             double& cash,
-            Date step_start,
-            Date step_end,
+            StepContext& step,
             const std::shared_ptr<const YieldCurve>& curve) = 0;
+
+        /**
+         * @brief Create an instance for exclusive use by a single scenario.
+         *
+         * @return A fresh copy, or null if this instance is stateless and may be shared.
+         */
+        virtual std::shared_ptr<Strategy> clone() const {
+            return nullptr;
+        }
     };
 
 }
@@ -25,10 +25,26 @@
     SOFTWARE.
 */
 
+#include <atomic>
 #include <functional>
+#include "CancellationToken.h"
 
 namespace ALM {
 
+    /**
+     * @brief Outcome of a cancellable batch.
+     */
+    struct BatchStatus {
+        size_t completed = 0;       ///< Tasks that ran to the end
+        size_t interrupted = 0;     ///< Tasks that started and stopped on the token
+        size_t skipped = 0;         ///< Tasks never started because the token had fired
+        bool cancelled = false;     ///< The token fired before the batch finished
+
+        bool complete() const {
+            return interrupted == 0 && skipped == 0;
+        }
+    };
+
     /**
      * @brief Abstract base class for submitting and waiting on a batch of tasks.
      */
@@ -41,6 +57,49 @@ namespace ALM {
          */
         virtual void submitAndWait(const std::vector<std::function<void()>>& tasks) = 0;
 
+        /**
+         * @brief Submit a batch that stops early once the token fires.
+         *
+         * Tasks not yet started when the token fires are skipped; running tasks stop at their
+         * next check of the token by throwing OperationCancelled. Other exceptions propagate as
+         * with the plain overload. Works with any executor: tasks are wrapped, not interrupted.
+         */
+        BatchStatus submitAndWait(const std::vector<std::function<void()>>& tasks, const CancellationToken& token) {
+            if (!token.cancellable()) {
+                submitAndWait(tasks);
+                BatchStatus status;
+                status.completed = tasks.size();
+                return status;
+            }
+
+            std::atomic<size_t> completed(0), interrupted(0), skipped(0);
+            std::vector<std::function<void()>> wrapped;
+            wrapped.reserve(tasks.size());
+            for (const auto& task : tasks) {
+                wrapped.push_back([&task, &token, &completed, &interrupted, &skipped]() {
+                    if (token.cancelled()) {
+                        ++skipped;
+                        return;
+                    }
+                    try {
+                        task();
+                        ++completed;
+                    }
+                    catch (const OperationCancelled&) {
+                        ++interrupted;
+                    }
+                    });
+            }
+            submitAndWait(wrapped);
+
+            BatchStatus status;
+            status.completed = completed.load();
+            status.interrupted = interrupted.load();
+            status.skipped = skipped.load();
+            status.cancelled = !status.complete() || token.cancelled();
+            return status;
+        }
+
     protected:
         TaskExecutor() = default;
     };
@@ -0,0 +1,195 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <thread>
+#include "TaskExecutor.h"
+#include "Trace.h"
+
+namespace ALM {
+
+    /**
+     * @brief Portable executor backed by a fixed set of std::thread workers.
+     *
+     * The calling thread works through its own batch alongside the workers, so a pool of
+     * `threads` runs that many tasks at once with threads - 1 workers, a pool of one runs
+     * sequentially, and a task may itself submit a batch without exhausting the pool. The
+     * first exception thrown by a task is rethrown to the caller once the batch has drained.
+     *
+     * Workers serve batches from concurrent submitters in submission order by default. With
+     * Scheduling::RoundRobin they take one task at a time from each pending batch in turn, so a
+     * small batch submitted behind a large one is not starved, at the cost of a lock per task.
+     */
+    class ThreadPoolExecutor : public TaskExecutor {
+    public:
+        enum class Scheduling {
+            Fifo,           ///< Drain the oldest pending batch first
+            RoundRobin      ///< Rotate over pending batches task by task
+        };
+
+        explicit ThreadPoolExecutor(size_t threads = std::thread::hardware_concurrency(), Scheduling scheduling = Scheduling::Fifo)
+            : threads_(threads > 0 ? threads : 1), scheduling_(scheduling)
+        {
+            workers_.reserve(threads_ - 1);
+            for (size_t i = 1; i < threads_; ++i) {
+                workers_.emplace_back([this]() { work(); });
+            }
+        }
+
+        ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+        ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+        ~ThreadPoolExecutor() {
+            {
+                std::lock_guard lock(mutex_);
+                stopping_ = true;
+            }
+            available_.notify_all();
+            for (auto& worker : workers_) {
+                worker.join();
+            }
+        }
+
+        /**
+         * @brief Number of tasks run concurrently, counting the calling thread.
+         */
+        size_t threads() const { return threads_; }
+
+        using TaskExecutor::submitAndWait;
+
+        void submitAndWait(const std::vector<std::function<void()>>& tasks) override {
+            if (tasks.empty()) return;
+            ALM_TRACE_SCOPE("executor", "ThreadPoolExecutor::submitAndWait");
+            ALM_TRACE_COUNTER("executor", "ThreadPoolExecutor::batchSize", tasks.size());
+
+            auto batch = std::make_shared<Batch>(tasks);
+            if (!workers_.empty()) {
+                {
+                    std::lock_guard lock(mutex_);
+                    pending_.push_back(batch);
+                }
+                available_.notify_all();
+            }
+
+            drain(*batch);
+
+            {
+                ALM_TRACE_SCOPE("executor", "ThreadPoolExecutor::wait");
+                std::unique_lock lock(mutex_);
+                finished_.wait(lock, [&batch]() { return batch->done.load() == batch->size; });
+                std::erase(pending_, batch);
+            }
+
+            if (batch->error) {
+                std::rethrow_exception(batch->error);
+            }
+        }
+
+    private:
+        struct Batch {
+            explicit Batch(const std::vector<std::function<void()>>& tasks)
+                : tasks(tasks), size(tasks.size()) {
+            }
+
+            const std::vector<std::function<void()>>& tasks;
+            const size_t size;
+            std::atomic<size_t> next{ 0 };
+            std::atomic<size_t> done{ 0 };
+            std::exception_ptr error;
+            std::mutex error_mutex;
+        };
+
+        // Claim and run tasks until none are left to start
+        void drain(Batch& batch) {
+            while (runNext(batch)) {
+            }
+        }
+
+        // Claim and run one task; false if every task has been claimed
+        bool runNext(Batch& batch) {
+            size_t i = batch.next++;
+            if (i >= batch.size) return false;
+
+            try {
+                ALM_TRACE_SCOPE("executor", "ThreadPoolExecutor::task");
+                batch.tasks[i]();
+            }
+            catch (...) {
+                std::lock_guard lock(batch.error_mutex);
+                if (!batch.error) batch.error = std::current_exception();
+            }
+
+            if (++batch.done == batch.size) {
+                std::lock_guard lock(mutex_);
+                finished_.notify_all();
+            }
+            return true;
+        }
+
+        void work() {
+            while (true) {
+                std::shared_ptr<Batch> batch;
+                {
+                    std::unique_lock lock(mutex_);
+                    available_.wait(lock, [this]() { return stopping_ || !pending_.empty(); });
+                    if (stopping_) return;
+
+                    size_t index = scheduling_ == Scheduling::RoundRobin ? next_batch_++ % pending_.size() : 0;
+                    batch = pending_[index];
+                    if (batch->next.load() >= batch->size) {
+                        // Every task has been claimed; the submitter removes it once drained
+                        pending_.erase(pending_.begin() + static_cast<std::ptrdiff_t>(index));
+                        continue;
+                    }
+                }
+                if (scheduling_ == Scheduling::RoundRobin) {
+                    runNext(*batch);
+                }
+                else {
+                    drain(*batch);
+                }
+            }
+        }
+
+        size_t threads_;
+        Scheduling scheduling_;
+        size_t next_batch_ = 0;     // Round-robin cursor over pending_
+        std::vector<std::thread> workers_;
+        std::deque<std::shared_ptr<Batch>> pending_;
+        std::mutex mutex_;
+        std::condition_variable available_;
+        std::condition_variable finished_;
+        bool stopping_ = false;
+    };
+
+}
@@ -0,0 +1,371 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <map>
+#include <string>
+#include <utility>
+#include <ostream>
+#include <iomanip>
+#include <algorithm>
+
+/**
+ * Hot-path instrumentation is compiled out unless ALM_ENABLE_TRACING is defined, in which case
+ * ALM_TRACE_SCOPE times the enclosing scope and ALM_TRACE_COUNTER samples a value. Category and
+ * name must be string literals; only the pointers are recorded.
+ */
+#ifdef ALM_ENABLE_TRACING
+#define ALM_TRACE_CONCAT_(a, b) a##b
+#define ALM_TRACE_CONCAT(a, b) ALM_TRACE_CONCAT_(a, b)
+#define ALM_TRACE_SCOPE(category, name) ::ALM::Trace::Scope ALM_TRACE_CONCAT(alm_trace_scope_, __LINE__)(category, name)
+#define ALM_TRACE_COUNTER(category, name, value) ::ALM::Trace::counter(category, name, static_cast<double>(value))
+#else
+#define ALM_TRACE_SCOPE(category, name) ((void)0)
+#define ALM_TRACE_COUNTER(category, name, value) ((void)0)
+#endif
+
+namespace ALM {
+
+    /**
+     * @brief Per-thread event recorder behind the ALM_TRACE_* macros.
+     *
+     * Each thread appends to its own fixed-size ring buffer without locking; once full, the
+     * oldest events are overwritten, so a long run keeps its most recent window. Buffers are
+     * owned by the trace and outlive their threads until a dump has collected them: a thread
+     * that has exited appears in the next dump only, after which its buffer is freed. Dump with
+     * writeChromeJson (open the file in chrome://tracing or ui.perfetto.dev) or writeSummary
+     * once traced work has finished; dumping while threads are still recording may show partly
+     * written events.
+     */
+    class Trace {
+    public:
+        struct Event {
+            const char* category;
+            const char* name;
+            int64_t start_ns;       ///< Since the trace epoch
+            int64_t duration_ns;    ///< Complete events only
+            double value;           ///< Counter events only
+            char phase;             ///< 'X' complete, 'C' counter
+        };
+
+        static constexpr size_t DefaultCapacity = size_t(1) << 16;
+
+        /// Whether the ALM_TRACE_* macros record anything in this build
+        static constexpr bool enabled() {
+#ifdef ALM_ENABLE_TRACING
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /// Events kept per thread; applies to threads that have not recorded yet
+        static void setCapacity(size_t events) {
+            std::lock_guard lock(registry().mutex);
+            registry().capacity = std::max<size_t>(events, 1);
+        }
+
+        /// Nanoseconds since the trace epoch
+        static int64_t now() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - registry().epoch).count();
+        }
+
+        static void complete(const char* category, const char* name, int64_t start_ns, int64_t duration_ns) {
+            local().push({ category, name, start_ns, duration_ns, 0.0, 'X' });
+        }
+
+        static void counter(const char* category, const char* name, double value) {
+            local().push({ category, name, now(), 0, value, 'C' });
+        }
+
+        /// Drops all recorded events; call only while no thread is recording
+        static void clear() {
+            std::lock_guard lock(registry().mutex);
+            std::erase_if(registry().buffers, [](const std::unique_ptr<Buffer>& buffer) {
+                return buffer->retired.load(std::memory_order_acquire);
+                });
+            for (auto& buffer : registry().buffers) {
+                buffer->written.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief RAII timer recording a complete event from construction to destruction.
+         */
+        class Scope {
+        public:
+            Scope(const char* category, const char* name)
+                : category_(category), name_(name), start_(now()) {
+            }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+            ~Scope() {
+                complete(category_, name_, start_, now() - start_);
+            }
+
+        private:
+            const char* category_;
+            const char* name_;
+            int64_t start_;
+        };
+
+        /**
+         * @brief Writes all buffered events in Chrome trace-event JSON, one track per thread.
+         */
+        static void writeChromeJson(std::ostream& out) {
+            auto threads = collect();
+            out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+            bool first = true;
+            auto separator = [&]() -> std::ostream& {
+                out << (first ? "\n" : ",\n");
+                first = false;
+                return out;
+                };
+
+            out << std::fixed << std::setprecision(3);
+            for (const auto& thread : threads) {
+                separator() << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << thread.id
+                    << ",\"args\":{\"name\":\"thread " << thread.id << "\"}}";
+
+                for (const Event& event : thread.events) {
+                    separator() << "{\"ph\":\"" << event.phase << "\",\"cat\":\"" << event.category
+                        << "\",\"name\":\"" << event.name << "\",\"pid\":1,\"tid\":" << thread.id
+                        << ",\"ts\":" << event.start_ns / 1000.0;
+                    if (event.phase == 'X')
+                        out << ",\"dur\":" << event.duration_ns / 1000.0 << "}";
+                    else
+                        out << ",\"args\":{\"value\":" << event.value << "}}";
+                }
+            }
+            out << "\n]}\n";
+        }
+
+        /**
+         * @brief Writes per-scope call counts, inclusive and self time, and counter statistics.
+         *
+         * Self time excludes nested scopes on the same thread, so the self column adds up to
+         * the traced time and shows where the wall-clock actually went.
+         */
+        static void writeSummary(std::ostream& out) {
+            struct Timing {
+                size_t calls = 0;
+                int64_t total_ns = 0;
+                int64_t self_ns = 0;
+                int64_t max_ns = 0;
+                size_t threads = 0;
+                size_t last_thread = 0;
+            };
+            struct Samples {
+                size_t count = 0;
+                double sum = 0.0;
+                double max = 0.0;
+                double last = 0.0;
+            };
+
+            std::map<std::pair<std::string, std::string>, Timing> timings;
+            std::map<std::pair<std::string, std::string>, Samples> counters;
+            int64_t begin = 0, end = 0;
+            bool any = false;
+            size_t dropped = 0;
+
+            for (const auto& thread : collect()) {
+                dropped += thread.dropped;
+
+                std::vector<const Event*> scopes;
+                for (const Event& event : thread.events) {
+                    if (event.phase == 'C') {
+                        Samples& samples = counters[{ event.category, event.name }];
+                        samples.max = samples.count ? std::max(samples.max, event.value) : event.value;
+                        samples.sum += event.value;
+                        samples.last = event.value;
+                        ++samples.count;
+                        continue;
+                    }
+                    scopes.push_back(&event);
+                }
+
+                // Parents start no later and end no earlier than their children
+                std::sort(scopes.begin(), scopes.end(), [](const Event* a, const Event* b) {
+                    if (a->start_ns != b->start_ns) return a->start_ns < b->start_ns;
+                    return a->duration_ns > b->duration_ns;
+                    });
+
+                std::vector<std::pair<int64_t, Timing*>> open;
+                for (const Event* event : scopes) {
+                    int64_t stop = event->start_ns + event->duration_ns;
+                    while (!open.empty() && open.back().first <= event->start_ns) open.pop_back();
+
+                    Timing& timing = timings[{ event->category, event->name }];
+                    if (timing.last_thread != thread.id) {
+                        ++timing.threads;
+                        timing.last_thread = thread.id;
+                    }
+                    ++timing.calls;
+                    timing.total_ns += event->duration_ns;
+                    timing.self_ns += event->duration_ns;
+                    timing.max_ns = std::max(timing.max_ns, event->duration_ns);
+                    if (!open.empty() && stop <= open.back().first) open.back().second->self_ns -= event->duration_ns;
+                    open.push_back({ stop, &timing });
+
+                    begin = any ? std::min(begin, event->start_ns) : event->start_ns;
+                    end = any ? std::max(end, stop) : stop;
+                    any = true;
+                }
+            }
+
+            std::vector<std::pair<std::pair<std::string, std::string>, Timing>> rows(timings.begin(), timings.end());
+            std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) { return a.second.self_ns > b.second.self_ns; });
+
+            out << std::left << std::setw(14) << "category" << std::setw(40) << "scope"
+                << std::right << std::setw(10) << "calls" << std::setw(8) << "threads"
+                << std::setw(14) << "total ms" << std::setw(14) << "self ms"
+                << std::setw(12) << "mean us" << std::setw(12) << "max us" << "\n";
+
+            out << std::fixed;
+            for (const auto& [key, timing] : rows) {
+                out << std::left << std::setw(14) << key.first << std::setw(40) << key.second
+                    << std::right << std::setw(10) << timing.calls << std::setw(8) << timing.threads
+                    << std::setprecision(3)
+                    << std::setw(14) << timing.total_ns / 1e6 << std::setw(14) << timing.self_ns / 1e6
+                    << std::setprecision(2)
+                    << std::setw(12) << timing.total_ns / 1e3 / static_cast<double>(timing.calls)
+                    << std::setw(12) << timing.max_ns / 1e3 << "\n";
+            }
+            out << std::setprecision(3) << "traced wall-clock: " << (any ? (end - begin) / 1e6 : 0.0) << " ms\n";
+
+            if (!counters.empty()) {
+                out << "\n" << std::left << std::setw(14) << "category" << std::setw(40) << "counter"
+                    << std::right << std::setw(10) << "samples" << std::setw(16) << "mean"
+                    << std::setw(16) << "max" << std::setw(16) << "last" << "\n";
+                for (const auto& [key, samples] : counters) {
+                    out << std::left << std::setw(14) << key.first << std::setw(40) << key.second
+                        << std::right << std::setw(10) << samples.count << std::setprecision(2)
+                        << std::setw(16) << samples.sum / static_cast<double>(samples.count)
+                        << std::setw(16) << samples.max << std::setw(16) << samples.last << "\n";
+                }
+            }
+
+            if (dropped > 0) {
+                out << dropped << " older events were overwritten; raise Trace::setCapacity for a full record\n";
+            }
+        }
+
+    private:
+        struct Buffer {
+            Buffer(size_t capacity, size_t id)
+                : events(capacity), id(id) {
+            }
+
+            void push(const Event& event) {
+                uint64_t n = written.load(std::memory_order_relaxed);
+                events[n % events.size()] = event;
+                written.store(n + 1, std::memory_order_release);
+            }
+
+            std::vector<Event> events;
+            std::atomic<uint64_t> written{ 0 };
+            std::atomic<bool> retired{ false };     // owning thread has exited
+            size_t id;
+        };
+
+        // Retires the thread's buffer on thread exit so the next dump can free it
+        struct Owner {
+            Buffer* buffer = nullptr;
+
+            ~Owner() {
+                if (buffer) buffer->retired.store(true, std::memory_order_release);
+            }
+        };
+
+        struct Registry {
+            std::mutex mutex;
+            std::vector<std::unique_ptr<Buffer>> buffers;
+            size_t next_id = 1;
+            size_t capacity = DefaultCapacity;
+            std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+        };
+
+        struct ThreadEvents {
+            size_t id;
+            size_t dropped;
+            std::vector<Event> events;      ///< Oldest first
+        };
+
+        static Registry& registry() {
+            static Registry instance;
+            return instance;
+        }
+
+        // The calling thread's buffer, registered on first use
+        static Buffer& local() {
+            thread_local Owner owner;
+            if (!owner.buffer) {
+                Registry& r = registry();
+                std::lock_guard lock(r.mutex);
+                r.buffers.push_back(std::make_unique<Buffer>(r.capacity, r.next_id++));
+                owner.buffer = r.buffers.back().get();
+            }
+            return *owner.buffer;
+        }
+
+        // Events of every buffer, oldest first; frees the buffers of exited threads once read
+        
+
+static std::vector<ThreadEvents> collect() {
+            Registry& r = registry();
+            std::lock_guard lock(r.mutex);
+
+            std::vector<ThreadEvents> threads;
+            std::erase_if(r.buffers, [&threads](const std::unique_ptr<Buffer>& buffer) {
+                // Checked before reading: a retired buffer receives no further events
+                bool retired = buffer->retired.load(std::memory_order_acquire);
+                uint64_t written = buffer->written.load(std::memory_order_acquire);
+                size_t capacity = buffer->events.size();
+                size_t kept = static_cast<size_t>(std::min<uint64_t>(written, capacity));
+                if (kept > 0) {
+                    ThreadEvents thread{ buffer->id, static_cast<size_t>(written - kept), {} };
+                    thread.events.reserve(kept);
+                    for (uint64_t i = written - kept; i < written; ++i) {
+                        thread.events.push_back(buffer->events[i % capacity]);
+                    }
+                    threads.push_back(std::move(thread));
+                }
+                return retired;
+                });
+            return threads;
+        }
+    };
+
+}
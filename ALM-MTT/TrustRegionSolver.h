@@ -5,7 +5,8 @@
 #include <memory>
 #include "SolverXd.h"
 #include "Constraint.h"
-#include "UI.h"
+#include "Log.h"
+#include "Trace.h"
 
 namespace ALM {
 
@@ -32,9 +33,13 @@ namespace ALM {
             int n = x.size();
 
             for (int iter = 0; iter < max_iter_; ++iter) {
+                ALM_TRACE_SCOPE("solver", "TrustRegionSolver::iteration");
                 Eigen::VectorXd grad;
                 Eigen::MatrixXd hess;
-                computeGradientAndHessian(f, x, fx, grad, hess);
+                {
+                    ALM_TRACE_SCOPE("solver", "TrustRegionSolver::gradientAndHessian");
+                    computeGradientAndHessian(f, x, fx, grad, hess);
+                }
 
                 double grad_norm = grad.norm();
                 if (grad_norm < tol_) {
@@ -60,7 +65,7 @@ namespace ALM {
 
                 delta_ *= adjustRadius(rho);
 
-                UI::debugPrint("Iter " + std::to_string(iter) + ", fx = " + std::to_string(fx) + ", radius = " + std::to_string(delta_));
+                ALM_LOG_DEBUG("Iter {}, fx = {}, radius = {}", iter, fx, delta_);
             }
 
             return { x, fx, max_iter_, false };
@@ -5,6 +5,7 @@
 #include <limits>
 #include <functional>
 #include <cctype>
+#include "Log.h"
 
 namespace ALM {
 
@@ -34,10 +35,11 @@ namespace ALM {
 		template<typename T>
 		static T ask(const std::string& prompt, const T& default_value) {
 			while (true) {
+				Log::flush();
 				std::cout  
-					<< (useColor ? Color::Cyan : "")
+					<< (use_color_ ? Color::Cyan : "")
 					<< prompt << " [default: " << default_value << "]: "
-					<< (useColor ? Color::Reset : "");
+					<< (use_color_ ? Color::Reset : "");
 
 				std::string input;
 				std::getline(std::cin, input);
@@ -56,27 +58,15 @@ namespace ALM {
 			}
 		}
 
-		// Specialization for std::string
-		template<>
-		static std::string ask<std::string>(const std::string& prompt, const std::string& default_value) {
-			std::cout 
-				<< (useColor ? Color::Cyan : Color::None)
-				<< prompt << " [default: " << default_value << "]: "
-				<< (useColor ? Color::Reset : Color::None);
-
-			std::string input;
-			std::getline(std::cin, input);
-			return input.empty() ? default_value : input;
-		}
-
 		// Ask for Yes/No input
 		static bool askYesNo(const std::string& prompt, bool default_value = true) {
 			std::string default_str = default_value ? "Y" : "N";
 			while (true) {
+				Log::flush();
 				std::cout 
-					<< (useColor ? Color::Cyan : Color::None)
+					<< (use_color_ ? Color::Cyan : Color::None)
 					<< prompt << " [Y/N] (default: " << default_str << "): "
-					<< (useColor ? Color::Reset : Color::None);
+					<< (use_color_ ? Color::Reset : Color::None);
 				std::string input;
 				std::getline(std::cin, input);
 				if (input.empty()) return default_value;
@@ -92,44 +82,50 @@ namespace ALM {
 		// Print a message
 		static void print(const std::string& msg) {
 			if (verbosity_ < Verbosity::Info) return;
+			auto lock = Log::lockOutput();
 			std::cout << msg << "\n";
 		}
 
 		static void debugPrint(const std::string& msg) {
 			if (verbosity_ < Verbosity::Debug) return;
-			std::cout << (useColor ? Color::Gray : Color::None)
+			auto lock = Log::lockOutput();
+			std::cout << (use_color_ ? Color::Gray : Color::None)
 				<< "[DEBUG] " << msg
-				<< (useColor ? Color::Reset : Color::None) << "\n";
+				<< (use_color_ ? Color::Reset : Color::None) << "\n";
 		}
 
 		// Print a section header
 		static void section(const std::string& title) {
 			if (verbosity_ < Verbosity::Info) return;
+			auto lock = Log::lockOutput();
 			std::cout 
-				<< (useColor ? Color::BoldCyan : Color::None)
+				<< (use_color_ ? Color::BoldCyan : Color::None)
 				<< "\n=== " << title << " ===\n"
-				<< (useColor ? Color::Reset : Color::None);
+				<< (use_color_ ? Color::Reset : Color::None);
 		}
 
 		// Print a warning
 		static void warn(const std::string& msg) {
 			if (verbosity_ < Verbosity::Warn) return;
+			auto lock = Log::lockOutput();
 			std::cout 
-				<< (useColor ? Color::Yellow : Color::None)
+				<< (use_color_ ? Color::Yellow : Color::None)
 				<< "[WARNING] " << msg << "\n"
-				<< (useColor ? Color::Reset : Color::None);
+				<< (use_color_ ? Color::Reset : Color::None);
 		}
 
 		// Print an error
 		static void error(const std::string& msg) {
 			if (verbosity_ < Verbosity::Error) return;
+			auto lock = Log::lockOutput();
 			std::cout 
-				<< (useColor ? Color::Red : Color::None)
+				<< (use_color_ ? Color::Red : Color::None)
 				<< "[ERROR] " << msg <<  "\n"
-				<< (useColor ? Color::Reset : Color::None);
+				<< (use_color_ ? Color::Reset : Color::None);
 		}
 
 		static void clearScreen(bool hard = true) {
+			auto lock = Log::lockOutput();
 			if (hard && use_color_) {
 				std::cout << "\033[2J\033[H";
 			}
@@ -140,10 +136,12 @@ namespace ALM {
 		
 		static void useColor(bool use_color = true) {
 			use_color_ = use_color;
+			Log::useColor(use_color);
 		}
 
 		static void setVerbosity(Verbosity verbosity = Verbosity::Info) {
 			verbosity_ = verbosity;
+			Log::setLevel(static_cast<Log::Level>(verbosity));
 		}
 	private:
 
@@ -151,4 +149,18 @@ namespace ALM {
 		static inline Verbosity verbosity_ = Verbosity::Info;
 	};
 
+	// Specialization for std::string; declared at namespace scope so it is portable beyond MSVC
+	template<>
+	inline std::string UI::ask<std::string>(const std::string& prompt, const std::string& default_value) {
+		Log::flush();
+		std::cout 
+			<< (use_color_ ? Color::Cyan : Color::None)
+			<< prompt << " [default: " << default_value << "]: "
+			<< (use_color_ ? Color::Reset : Color::None);
+
+		std::string input;
+		std::getline(std::cin, input);
+		return input.empty() ? default_value : input;
+	}
+
 }  // namespace ALM
@@ -0,0 +1,78 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Harold James Krause
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <cmath>
+#include "Date.h"
+#include "DayCounter.h"
+#include "ShortRateModel.h"
+
+namespace ALM {
+
+    /**
+     * @brief Vasicek model dr = a (b - r) dt + sigma dW, stepped with its exact Gaussian transition.
+     */
+    class Vasicek final : public ShortRateModel {
+    public:
+        /**
+         * @param a Mean reversion speed.
+         * @param b Long-run mean rate.
+         * @param sigma Rate volatility.
+         * @param r0 Initial short rate.
+         */
+        Vasicek(double a, double b, double sigma, double r0)
+            : a_(a), b_(b), sigma_(sigma), r0_(r0) {
+        }
+
+        double initialState() const override {
+            return r0_;
+        }
+
+        double evolve(double x, double dt, double z) const override {
+            if (a_ == 0.0)
+                return x + sigma_ * std::sqrt(dt) * z;
+            double decay = std::exp(-a_ * dt);
+            double stdev = sigma_ * std::sqrt(-std::expm1(-2.0 * a_ * dt) / (2.0 * a_));
+            return x * decay + b_ * (1.0 - decay) + stdev * z;
+        }
+
+        double discount(const Date& ref, const Date& t, const DayCounter& dc) const override {
+            double T = dc.yearFraction(ref, t);
+            if (a_ == 0.0)
+                return std::exp(-r0_ * T + sigma_ * sigma_ * T * T * T / 6.0);
+
+            double B = -std::expm1(-a_ * T) / a_;
+            double log_A = (b_ - sigma_ * sigma_ / (2.0 * a_ * a_)) * (B - T) - sigma_ * sigma_ * B * B / (4.0 * a_);
+            return std::exp(log_A - B * r0_);
+        }
+
+    private:
+        double a_;
+        double b_;
+        double sigma_;
+        double r0_;
+    };
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <type_traits>
 #include "Date.h"
 
 namespace ALM {
@@ -13,4 +14,8 @@ namespace ALM {
 		virtual Date reference() const = 0;
 	};
 
+	// Concrete curve types accepted by the statically dispatched pricing and projection paths
+	template <typename Curve>
+	concept YieldCurveType = std::is_base_of_v<YieldCurve, Curve>;
+
 }
\ No newline at end of file